@@ -0,0 +1,165 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_Allocator_h)
+#define ALIZE_Allocator_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+
+namespace alize
+{
+  /// Abstract class for the memory used by the vectors (RealVector,
+  /// ULongVector). All the blocks are aligned on ALIGNMENT bytes so that
+  /// the arrays can be processed with SIMD instructions.\n
+  /// The vectors created without allocator use allocateAligned() and
+  /// deallocateAligned().
+  ///
+  class ALIZE_API Allocator : public Object
+  {
+  public :
+
+    /// Alignment in bytes of the blocks returned by allocate()
+    static const unsigned long ALIGNMENT = 64;
+
+    /// Allocates a block of memory
+    /// @param size size of the block in bytes
+    /// @return a block aligned on ALIGNMENT bytes or NULL if there is
+    ///     not enough memory
+    ///
+    virtual void* allocate(unsigned long size) = 0;
+
+    /// Gives back a block returned by allocate()
+    /// @param p the block (can be NULL)
+    ///
+    virtual void deallocate(void* p) = 0;
+
+    /// Allocates a block of memory with the aligned allocation functions
+    /// of the system. Thread-safe.
+    /// @param size size of the block in bytes
+    /// @return a block aligned on ALIGNMENT bytes or NULL if there is
+    ///     not enough memory
+    ///
+    static void* allocateAligned(unsigned long size);
+
+    /// Gives back a block returned by allocateAligned()
+    /// @param p the block (can be NULL)
+    ///
+    static void deallocateAligned(void* p);
+
+  protected :
+    Allocator();
+  };
+
+  /// Allocator handing out blocks from big chunks of memory. deallocate()
+  /// does nothing : the memory of all the blocks is given back at once by
+  /// reset() and the chunks are reused by the next allocations. Use it for
+  /// temporary vectors created again and again in a loop.\n
+  /// Not thread-safe : use one arena per thread.
+  ///
+  class ALIZE_API ArenaAllocator : public Allocator
+  {
+  public :
+
+    /// @param chunkSize size in bytes of the chunks. Bigger blocks get
+    ///     their own chunk.
+    ///
+    explicit ArenaAllocator(unsigned long chunkSize = 1048576);
+    virtual ~ArenaAllocator();
+
+    virtual void* allocate(unsigned long size);
+    virtual void deallocate(void* p);
+
+    /// Makes the memory of all the blocks available again. The vectors
+    /// using this arena must not be used anymore.
+    ///
+    void reset();
+
+    /// Returns the memory held by the arena
+    /// @return the size in bytes of all the chunks
+    ///
+    unsigned long getChunksSize() const;
+
+    virtual String getClassName() const;
+
+  private :
+
+    struct Chunk
+    {
+      Chunk*        next;
+      unsigned long size;
+    };
+
+    const unsigned long _chunkSize;
+    Chunk*              _pFirst;
+    Chunk*              _pCurrent;
+    unsigned long       _used; /*!< bytes used in the current chunk */
+
+    ArenaAllocator(const ArenaAllocator&); /*!Not implemented*/
+    const ArenaAllocator& operator=(
+                const ArenaAllocator&); /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_Allocator_h)
@@ -97,6 +97,7 @@ namespace alize
                              BigEndian be = BIGENDIAN_AUTO);
     virtual ~AudioFileReader();
     virtual bool readFrame(AudioFrame& f);
+    virtual unsigned long readFrames(FloatVector& v, unsigned long maxCount);
     virtual void seekFrame(unsigned long pos);
 
     /// Same effect as seekFrame(0)<br/>
@@ -144,6 +145,7 @@ namespace alize
     bool getBigEndian(const Config&, BigEndian) const;
     void readParams();
     unsigned long getHeaderLength();
+    bool loadSamples();
     
     FileReader*    _pReader;
     unsigned long  _frameCount;
@@ -155,6 +157,12 @@ namespace alize
     bool           _paramDefined;
     bool           _seekWanted;
     unsigned long  _seekWantedIdx;
+    // samples of the selected channel decoded from a chunk of the file
+    FloatVector    _samples;
+    unsigned long  _samplesIndex;   // index of the first frame in _samples
+    unsigned long  _samplesChannel; // channel decoded in _samples
+    unsigned long  _fileFrameIndex; // next frame in the file, ULONG_MAX if unknown
+    short*         _pChunk;         // raw interleaved frames
   };
 
 } // end namespace alize
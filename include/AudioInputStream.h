@@ -66,6 +66,7 @@
 #endif
 
 #include "Object.h"
+#include "RealVector.h"
 
 namespace alize
 {
@@ -102,6 +103,17 @@ namespace alize
     ///
     virtual bool readFrame(AudioFrame& f) = 0;
 
+    /// Reads up to maxCount frames of the selected channel. The default
+    /// implementation calls readFrame() for each frame ; file readers
+    /// decode whole chunks of samples.
+    /// @param v vector to store the samples. Its size is set to the
+    ///     number of frames read
+    /// @param maxCount maximum number of frames to read
+    /// @return the number of frames read, 0 at the end of the stream
+    /// @exception IOException if an I/O error occurs
+    ///
+    virtual unsigned long readFrames(FloatVector& v, unsigned long maxCount);
+
     /// Sets the position indicator associated with the stream to
     /// a new position. Does not throw any exception or error if the position
     /// exceeds file length
@@ -232,6 +232,116 @@ namespace alize
     ///
     const String& getParam_featureServerMask() const;
 
+    /// Index of the coefficient tested by the frame selection
+    /// (0 by default : c0/energy)
+    /// @exception if the param does not exist
+    ///
+    unsigned long getParam_featureServerSelectionCoef() const;
+
+    /// Frames whose selection coefficient is lower are dropped.
+    /// See FeatureInputStreamSelector
+    /// @exception if the param does not exist
+    ///
+    real_t getParam_featureServerSelectionThreshold() const;
+
+    /// MEAN or MEAN_VARIANCE. See FeatureInputStreamNormalizer
+    /// @exception if the param does not exist
+    ///
+    const String& getParam_featureServerNormalization() const;
+
+    /// Size in frames of the sliding normalization window
+    /// (0 : each source is normalized as a whole)
+    /// @exception if the param does not exist
+    ///
+    unsigned long getParam_featureServerNormalizationWindow() const;
+
+    /// Half size of the delta regression window
+    /// See FeatureInputStreamDelta
+    /// @exception if the param does not exist
+    ///
+    unsigned long getParam_featureServerDeltaWindow() const;
+
+    /// false to compute the deltas only (true by default)
+    /// @exception if the param does not exist
+    ///
+    bool getParam_featureServerDeltaDelta() const;
+
+    /// Length of the analysis window in ms (20 by default)
+    /// See FeatureComputer
+    /// @exception if the param does not exist
+    ///
+    real_t getParam_featureComputerFrameLength() const;
+
+    /// Shift between two analysis windows in ms (10 by default)
+    /// @exception if the param does not exist
+    ///
+    real_t getParam_featureComputerFrameShift() const;
+
+    /// Pre-emphasis coefficient (0.97 by default, 0 = none)
+    /// @exception if the param does not exist
+    ///
+    real_t getParam_featureComputerPreEmphasis() const;
+
+    /// Number of mel filters (24 by default)
+    /// @exception if the param does not exist
+    ///
+    unsigned long getParam_featureComputerFilterCount() const;
+
+    /// Number of cepstral coefficients, c0 excluded (12 by default)
+    /// @exception if the param does not exist
+    ///
+    unsigned long getParam_featureComputerCepstralCount() const;
+
+    /// true to append the log energy (true by default)
+    /// @exception if the param does not exist
+    ///
+    bool getParam_featureComputerEnergy() const;
+
+    /// Low cutoff frequency of the filter bank in Hz (0 by default)
+    /// @exception if the param does not exist
+    ///
+    real_t getParam_featureComputerMinFrequency() const;
+
+    /// High cutoff frequency of the filter bank in Hz
+    /// (half the audio sample rate by default)
+    /// @exception if the param does not exist
+    ///
+    real_t getParam_featureComputerMaxFrequency() const;
+
+    /// true to save the features in big endian (false by default)
+    /// Only used by FeatureFileWriter
+    /// @exception if the param does not exist
+    ///
+    bool getParam_saveFeatureFileBigEndian() const;
+
+    /// Path of the top distributions cache files (optional)
+    /// @exception if the param does not exist
+    ///
+    const String& getParam_topDistribsCacheFilesPath() const;
+
+    /// Extension of the top distributions cache files (optional)
+    /// @exception if the param does not exist
+    ///
+    const String& getParam_topDistribsCacheFileExtension() const;
+
+    /// Memory (bytes) for the mixtures loaded on demand by
+    /// MixtureServer::getMixtureIndex() (optional)
+    /// @exception if the param does not exist
+    ///
+    unsigned long getParam_mixtureServerCacheMemAlloc() const;
+
+    /// Posteriors below this value are set to 0.0 by
+    /// MixtureStat::computeOccVect() (optional, 0.0 to disable)
+    /// @exception if the param does not exist
+    ///
+    real_t getParam_occPruningThreshold() const;
+
+    /// Number of best posteriors kept by MixtureStat::computeOccVect()
+    /// (optional, 0 to disable)
+    /// @exception if the param does not exist
+    ///
+    unsigned long getParam_occPruningTopDistribsCount() const;
+
     /// @exception if the param does not exist
     ///
     const String& getParam_featureFilesPath() const;
@@ -355,6 +465,26 @@ namespace alize
     bool  existsParam_topDistribsCount;
     bool  existsParam_featureServerBufferSize;
     bool  existsParam_featureServerMask;
+    bool  existsParam_featureServerSelectionCoef;
+    bool  existsParam_featureServerSelectionThreshold;
+    bool  existsParam_featureServerNormalization;
+    bool  existsParam_featureServerNormalizationWindow;
+    bool  existsParam_featureServerDeltaWindow;
+    bool  existsParam_featureServerDeltaDelta;
+    bool  existsParam_featureComputerFrameLength;
+    bool  existsParam_featureComputerFrameShift;
+    bool  existsParam_featureComputerPreEmphasis;
+    bool  existsParam_featureComputerFilterCount;
+    bool  existsParam_featureComputerCepstralCount;
+    bool  existsParam_featureComputerEnergy;
+    bool  existsParam_featureComputerMinFrequency;
+    bool  existsParam_featureComputerMaxFrequency;
+    bool  existsParam_saveFeatureFileBigEndian;
+    bool  existsParam_topDistribsCacheFilesPath;
+    bool  existsParam_topDistribsCacheFileExtension;
+    bool  existsParam_mixtureServerCacheMemAlloc;
+    bool  existsParam_occPruningThreshold;
+    bool  existsParam_occPruningTopDistribsCount;
     bool  existsParam_featureFlags;
     bool  existsParam_mixtureDistribCount;
     bool  existsParam_minLLK;
@@ -401,6 +531,26 @@ namespace alize
     String              _param_featureServerBufferSize; // can be a number
                                // or "ALL_FEATURES"
     String              _param_featureServerMask;
+    unsigned long       _param_featureServerSelectionCoef;
+    real_t              _param_featureServerSelectionThreshold;
+    String              _param_featureServerNormalization;
+    unsigned long       _param_featureServerNormalizationWindow;
+    unsigned long       _param_featureServerDeltaWindow;
+    bool                _param_featureServerDeltaDelta;
+    real_t              _param_featureComputerFrameLength;
+    real_t              _param_featureComputerFrameShift;
+    real_t              _param_featureComputerPreEmphasis;
+    unsigned long       _param_featureComputerFilterCount;
+    unsigned long       _param_featureComputerCepstralCount;
+    bool                _param_featureComputerEnergy;
+    real_t              _param_featureComputerMinFrequency;
+    real_t              _param_featureComputerMaxFrequency;
+    bool                _param_saveFeatureFileBigEndian;
+    String              _param_topDistribsCacheFilesPath;
+    String              _param_topDistribsCacheFileExtension;
+    unsigned long       _param_mixtureServerCacheMemAlloc;
+    real_t              _param_occPruningThreshold;
+    unsigned long       _param_occPruningTopDistribsCount;
     FeatureFlags        _param_featureFlags;
     unsigned long       _param_mixtureDistribCount;
     MixtureFileWriterFormat _param_saveMixtureFileFormat;
@@ -0,0 +1,171 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_Counters_h)
+#define ALIZE_Counters_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+#include "alizeString.h"
+
+namespace alize
+{
+  /// Process-wide instrumentation counters of the hot paths (file reading,
+  /// likelihood computation, EM accumulation).<br>
+  /// The counters are disabled by default : an update is then a test of a
+  /// flag. They are enabled with setEnabled() or by setting the
+  /// environment variable ALIZE_COUNTERS to the name of a file ("-" for
+  /// stderr) in which the counters are written in JSON when the process
+  /// exits.<br>
+  /// The updates are atomic so the counters can be shared by several
+  /// threads. The counters and the times (in microseconds) are 64 bits
+  /// wide even where unsigned long is 32 bits wide (Windows, 32 bits
+  /// systems) so that they do not wrap on long runs.
+  ///
+  /// @version 1.0
+  /// @date 2010
+
+  class ALIZE_API Counters
+  {
+  public :
+
+    enum Id
+    {
+      FILE_BYTES_READ,         ///< bytes read by FileReader
+      FILE_SEEKS,              ///< seeks of FileReader
+      FEATURES_READ,           ///< features read by FeatureFileReaderSingle
+      FEATURE_BUFFER_LOADS,    ///< buffer loads of FeatureFileReaderSingle
+      LLK_DISTRIB_EVALUATIONS, ///< distributions evaluated by computeLLK
+      TOP_DISTRIBS_CACHE_HITS, ///< frames read from a TopDistribsCache
+      EM_FEATURES,             ///< features accumulated by EM
+      EM_DISTRIBS_UPDATED,     ///< distributions updated by EM accumulation
+      FEATURE_BUFFER_LOAD_TIME,///< time spent loading feature buffers
+      LLK_TIME,                ///< time spent in StatServer::computeLLK
+      EM_TIME,                 ///< time spent in EM accumulation and getEM
+      COUNTER_COUNT
+    };
+
+    /// Measures the time spent in a scope and adds it to a counter
+    /// when the counters are enabled
+    ///
+    class ALIZE_API Timer
+    {
+    public :
+      explicit Timer(Id id)
+      :_id(id), _started(_enabled), _start(_started ? getTime() : 0) {}
+      ~Timer() { if (_started) add(_id, getTime()-_start); }
+    private :
+      const Id _id;
+      const bool _started;
+      const unsigned long long _start;
+      Timer(const Timer&);            /*!Not implemented*/
+      const Timer& operator=(const Timer&); /*!Not implemented*/
+    };
+
+    static bool isEnabled() { return _enabled; }
+    static void setEnabled(bool b);
+
+    /// Adds a value to a counter if the counters are enabled
+    /// @param id the counter
+    /// @param n the value to add
+    ///
+    static void add(Id id, unsigned long long n)
+    { if (_enabled) increase(id, n); }
+
+    /// Returns the value of a counter
+    ///
+    static unsigned long long get(Id id);
+
+    /// Returns the name of a counter, used as key in toJSON()
+    ///
+    static const char* getName(Id id);
+
+    /// Sets all the counters to 0
+    ///
+    static void reset();
+
+    /// Returns the counters as a JSON object
+    /// ({"fileBytesRead":1234, ...})
+    ///
+    static String toJSON();
+
+    /// Writes the counters in JSON in a file when the process exits
+    /// @param f the file name ("-" for stderr)
+    ///
+    static void dumpAtExit(const FileName& f);
+
+    /// Returns a monotonic time in microseconds
+    ///
+    static unsigned long long getTime();
+
+  private :
+
+    static bool _enabled;
+    static unsigned long long _values[COUNTER_COUNT];
+
+    static void increase(Id id, unsigned long long n);
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_Counters_h)
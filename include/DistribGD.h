@@ -71,6 +71,7 @@
 namespace alize
 {
   class Config;
+  class Mixture;
 
   /// Class for a distribution GD (gaussian with diagonal matrix)\n
   ///\n
@@ -159,6 +160,40 @@ namespace alize
     virtual lk_t computeLK(const Feature&) const;
     virtual lk_t computeLK(const Feature&, unsigned long idx) const;
 
+    /// Kernel computing the likelihood of a feature from the arrays of a
+    /// distribution GD
+    ///
+    typedef lk_t (*LKKernel)(const real_t* data, const real_t* mean,
+                             const real_t* covInv, real_t cst,
+                             unsigned long vectSize);
+
+    /// Returns the likelihood kernel of a dimension. The kernels of the
+    /// usual dimensions (20, 39, 40, 50 and 60) are specialized at compile
+    /// time, the other dimensions use a generic kernel. The kernel should
+    /// be selected once (for a mixture) and not for each feature.
+    /// @param vectSize dimension of the distributions
+    /// @return the kernel
+    ///
+    static LKKernel getLKKernel(unsigned long vectSize);
+
+    /// Returns the likelihood kernel of the dimension of a mixture
+    /// @param m the mixture
+    /// @return the kernel, or NULL if m is not a mixture GD
+    ///
+    static LKKernel getLKKernel(const Mixture& m);
+
+    /// Computes the likelihood with a kernel returned by getLKKernel().
+    /// The dimension of the data is not checked.
+    /// *** internal usage ***
+    /// @param k kernel of the dimension of the distribution
+    /// @param data array of vectSize values of the feature
+    ///
+    lk_t computeLK(const K&, LKKernel k, const real_t* data) const
+    {
+      return k(data, _meanVect.getArray(), _covInvVect.getArray(), _cst,
+               _vectSize);
+    }
+
     /// Sets a value in the covariance vector.
     /// A zero value is automatically replaced by a positive-and-non-zero
     /// value near to zero.
@@ -173,6 +208,13 @@ namespace alize
     ///
     virtual void computeAll();
 
+    /// Same as computeAll() but reads the covariance values from an
+    /// external array instead of the temporary covariance vector.
+    /// *** internal usage ***
+    /// @param cov array of vectSize covariance values
+    ///
+    void computeAll(const K&, const real_t* cov);
+
     /// Gets a value in the covariance vector.
     /// @param index position in the array
     /// @return the value of the covariance
@@ -233,11 +275,18 @@ namespace alize
     
   private :
     virtual Distrib& clone() const;
+    void computeAllFromCov(const real_t* cov);
+    static lk_t computeLKFromDistance(real_t cst, real_t distance);
+    template <unsigned long N> static lk_t computeLKFixed(const real_t*,
+                  const real_t*, const real_t*, real_t, unsigned long);
+    static lk_t computeLKGeneric(const real_t*, const real_t*,
+                  const real_t*, real_t, unsigned long);
 
     mutable DoubleVector _covVect;   /*!< temporary covariance
                                           vector. The vector is cleared
                                           after calling computeAll()*/
     DoubleVector         _covInvVect; /*!< inverse covariance vector */
+    const LKKernel       _lkKernel;   /*!< kernel of the dimension */
   };
 
 } // end namespace alize
@@ -256,7 +256,6 @@ namespace alize
                                           after calling computeAll()*/
     DoubleSquareMatrix  _covInvMatr; /*!< inverse covariance matrix */
     real_t              _cst;        /*!< constante */
-    DoubleVector        _tmpVect;
 
   };
 
@@ -132,6 +132,15 @@ namespace alize
     ///     
     void deleteUnreferencedDistrib(const Distrib& d);
 
+    /// Deletes the distribution at index i if it is not referenced by
+    /// other objects. The last distribution is moved to index i, so the
+    /// cost does not depend on the size of the vector.
+    /// @param i index of the distribution
+    /// @return true if the distribution has been deleted
+    /// @exception IndexOutOfBoundsException
+    ///
+    bool deleteUnreferencedDistribFast(unsigned long i);
+
     unsigned long size() const;
 
     void clear();
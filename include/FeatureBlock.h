@@ -0,0 +1,172 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_FeatureBlock_h)
+#define ALIZE_FeatureBlock_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+#include "Feature.h"
+#include "RealVector.h"
+#include "ULongVector.h"
+
+namespace alize
+{
+  /// A block of features stored in a contiguous matrix
+  /// (features x vectSize, one feature per row) with the validity and
+  /// the label code of each feature.
+  /// Filled by FeatureInputStream::readFeatures().
+  ///
+  /// @version 1.0
+  /// @date 2010
+
+  class ALIZE_API FeatureBlock : public Object
+  {
+
+  public :
+
+    /// Create an empty block
+    /// @param vectSize size of the acoustic parameters vectors
+    ///
+    explicit FeatureBlock(unsigned long vectSize = 0);
+    static FeatureBlock& create(unsigned long vectSize = 0);
+
+    virtual ~FeatureBlock();
+
+    /// Returns the number of features in the block
+    ///
+    unsigned long getFeatureCount() const;
+
+    /// Returns the size of the vectors
+    ///
+    unsigned long getVectSize() const;
+
+    /// Sets the size of the vectors. The data are lost if the size
+    /// changes.
+    /// @param vectSize size of the vectors
+    ///
+    void setVectSize(unsigned long vectSize);
+
+    /// Sets the number of features in the block. Memory is allocated
+    /// only when the block grows beyond its previous capacity.
+    /// @param n number of features
+    ///
+    void setFeatureCount(unsigned long n);
+
+    /// Use this method to access directly to the matrix. Feature #i
+    /// begins at getDataMatrix()+i*getVectSize()
+    /// @return a pointer on the first parameter of the first feature
+    ///
+    Feature::data_t* getDataMatrix() const;
+
+    /// Returns a pointer on the parameters of a feature
+    /// @param i index of the feature in the block
+    ///
+    Feature::data_t* getDataVector(unsigned long i) const;
+
+    bool isValid(unsigned long i) const;
+    void setValidity(unsigned long i, bool validity);
+    unsigned long getLabelCode(unsigned long i) const;
+    void setLabelCode(unsigned long i, unsigned long code);
+
+    /// Copies a feature of the block (parameters, validity and label
+    /// code) into f
+    /// @param i index of the feature in the block
+    /// @param f the feature to fill
+    ///
+    void getFeature(unsigned long i, Feature& f) const;
+
+    /// Copies f into the feature #i of the block
+    /// @param i index of the feature in the block
+    /// @param f the feature to copy
+    /// @exception Exception if the vector sizes are different
+    ///
+    void setFeature(unsigned long i, const Feature& f);
+
+    /// Keeps only some components of each feature. The data are moved in
+    /// place and the vector size becomes the size of the selection.
+    /// @param selection indices of the components to keep, in increasing
+    ///     order
+    /// @exception Exception if the selection is not increasing or if a
+    ///     component is outside of the vectors
+    ///
+    void selectComponents(const ULongVector& selection);
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private :
+
+    unsigned long _vectSize;
+    unsigned long _featureCount;
+    DoubleVector  _data;
+    ULongVector   _labelCodes;
+    ULongVector   _validities;
+
+    FeatureBlock(const FeatureBlock&); /* not implemented */
+    const FeatureBlock& operator=(const FeatureBlock&); /* not implemented */
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_FeatureBlock_h)
@@ -0,0 +1,205 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_FeatureComputer_h)
+#define ALIZE_FeatureComputer_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "FeatureInputStream.h"
+#include "alizeString.h"
+#include "Feature.h"
+#include "FeatureBlock.h"
+#include "FeatureFlags.h"
+#include "RealVector.h"
+#include "ULongVector.h"
+
+namespace alize
+{
+  class AudioInputStream;
+
+  /*!
+  Feature stream which computes cepstral features (MFCC) from the
+  samples of an audio stream while they are read, without any
+  intermediate feature file.<br>
+  For each frame : pre-emphasis y(n) = x(n) - a.x(n-1), Hamming window,
+  FFT (radix-2, the frame being padded with zeros), power spectrum,
+  triangular filter bank on the mel scale, log and DCT-II.
+  The output vector is [c1 ... cC E], E being the log energy of the
+  frame samples (optional), which matches the feature flags "1E0000".<br>
+  The parameters are read from the configuration (default values between
+  brackets) :
+  featureComputerFrameLength (20 ms), featureComputerFrameShift (10 ms),
+  featureComputerPreEmphasis (0.97), featureComputerFilterCount (24),
+  featureComputerCepstralCount (12), featureComputerEnergy (true),
+  featureComputerMinFrequency (0 Hz), featureComputerMaxFrequency
+  (half the sample rate of the audio stream).<br>
+  The audio samples are read by chunks in a sliding buffer so each
+  sample is read once when reading sequentially.
+
+  @version 1.0
+  @date 2010
+  */
+
+  class ALIZE_API FeatureComputer : public FeatureInputStream
+  {
+
+  public :
+
+    /// Build the object
+    /// @param a the input audio stream (selected channel)
+    /// @param c the configuration to use
+    /// @param sourceName name of the unique source of this stream
+    /// @param ownStream true if the audio stream must be deleted with
+    ///        this object
+    ///
+    FeatureComputer(AudioInputStream& a, const Config& c,
+                    const String& sourceName, bool ownStream = false);
+    static FeatureComputer& create(AudioInputStream& a, const Config& c,
+                    const String& sourceName, bool ownStream = false);
+
+    virtual bool addFeature(const Feature& f);
+
+    virtual bool readFeature(Feature& f, unsigned long step = 1);
+
+    virtual unsigned long readFeatures(FeatureBlock& b,
+                                       unsigned long maxCount);
+
+    /// Returns the number of complete frames of the audio stream
+    ///
+    virtual unsigned long getFeatureCount();
+
+    /// Returns the number of cepstral coefficients (+1 with the energy)
+    ///
+    virtual unsigned long getVectSize();
+
+    virtual const FeatureFlags& getFeatureFlags();
+
+    /// Returns the frame rate (1000/featureComputerFrameShift)
+    ///
+    virtual real_t getSampleRate();
+    virtual void reset();
+    virtual void close();
+    virtual unsigned long getSourceCount();
+    virtual unsigned long getFeatureCountOfASource(unsigned long srcIdx);
+    virtual unsigned long getFeatureCountOfASource(const String& src);
+    virtual unsigned long getFirstFeatureIndexOfASource(unsigned long srcIdx);
+    virtual unsigned long getFirstFeatureIndexOfASource(const String& src);
+    virtual const String& getNameOfASource(unsigned long srcIdx);
+    virtual void seekFeature(unsigned long featureNbr,
+                             const String& srcName = "");
+
+    virtual ~FeatureComputer();
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private:
+
+    AudioInputStream* _pInput;
+    bool              _ownStream;
+    String            _sourceName;
+    bool              _paramDefined;
+    FeatureFlags      _flags;
+    real_t            _frameRate;     // audio sample rate (Hz)
+    unsigned long     _frameLength;   // in samples
+    unsigned long     _frameShift;    // in samples
+    unsigned long     _fftSize;
+    unsigned long     _filterCount;
+    unsigned long     _cepstralCount;
+    bool              _useEnergy;
+    double            _preEmphasis;
+    unsigned long     _featureCount;
+    DoubleVector      _window;
+    ULongVector       _bitReverse;
+    DoubleVector      _twiddleRe;     // exp(-i.pi.k/h) at [h-1+k]
+    DoubleVector      _twiddleIm;
+    ULongVector       _filterFirstBin;
+    ULongVector       _filterOffset;  // weights of filter j in
+    DoubleVector      _filterWeights; // [_filterOffset[j], [j+1])
+    DoubleVector      _dct;           // _cepstralCount x _filterCount
+    DoubleVector      _frame;
+    DoubleVector      _re;
+    DoubleVector      _im;
+    DoubleVector      _power;
+    DoubleVector      _logEnergies;
+    FloatVector       _samples;       // samples [_samplesIndex, ...)
+    unsigned long     _samplesIndex;
+    FloatVector       _chunk;
+    unsigned long     _inputIdx;      // next sample read by the input
+    unsigned long     _pos;           // next feature to read
+
+    void defineParams();
+    void initFilterBank(double minFrequency, double maxFrequency);
+    bool loadSamples(unsigned long b, unsigned long e);
+    void fft();
+    bool computeFeature(unsigned long idx, Feature::data_t* out);
+    void resolveSeek();
+
+    FeatureComputer(const FeatureComputer&); /* not implemented */
+    const FeatureComputer& operator=(
+            const FeatureComputer&); /* not implemented */
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_FeatureComputer_h)
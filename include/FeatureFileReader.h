@@ -145,6 +145,12 @@ namespace alize
                              const String& srcName = "");
     virtual bool addFeature(const Feature& f);
     virtual bool readFeature(Feature& f, unsigned long s = 1);
+    virtual unsigned long readFeatures(FeatureBlock& b,
+                                       unsigned long maxCount);
+    virtual bool readSelectedFeature(Feature& f,
+                 const ULongVector& selection, unsigned long s = 1);
+    virtual unsigned long readSelectedFeatures(FeatureBlock& b,
+                 unsigned long maxCount, const ULongVector& selection);
 
     virtual bool writeFeature(const Feature& f, unsigned long step = 1);
 
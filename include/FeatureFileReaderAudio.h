@@ -0,0 +1,139 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_FeatureFileReaderAudio_h)
+#define ALIZE_FeatureFileReaderAudio_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "FeatureFileReaderSingle.h"
+
+
+namespace alize
+{
+  class Config;
+
+  /// Convenient class for reading features computed on the fly from an
+  /// audio file (see AudioFileReader for the audio parameters and
+  /// FeatureComputer for the feature parameters). The file is opened
+  /// only after calling one of the methods readFeature,
+  /// getFeatureCount, getVectSize, getFeatureFlags
+  ///
+  /// @version 1.0
+  /// @date 2010
+
+  class ALIZE_API FeatureFileReaderAudio : public FeatureFileReaderSingle
+  {
+
+  public :
+
+    /// Creates a reader for an audio file.
+    /// @param f a file to read. No path is required. It uses the
+    ///    parameters "audioFilesPath" and "loadAudioFileExtension" of the
+    ///    configuration.
+    /// @param c the configuration to use
+    /// @param ls address of a label server. can be NULL.
+    /// @param be big endian ? Can be BIGENDIAN_AUTO, BIGENDIAN_TRUE or
+    ///        BIGENDIAN_FALSE
+    ///
+    FeatureFileReaderAudio(const FileName& f,
+       const Config& c, LabelServer* ls = NULL,
+       BigEndian be = BIGENDIAN_AUTO, BufferUsage b = BUFFER_AUTO,
+       unsigned long bufferSize = 0,
+       HistoricUsage = ALL_FEATURES, unsigned long historicSize = 0);
+
+    /// See constructor with same parameters
+    ///
+    static FeatureFileReaderAudio& create(const FileName&, const Config&,
+        LabelServer* = NULL, BigEndian = BIGENDIAN_AUTO,
+        BufferUsage = BUFFER_AUTO, unsigned long bufferSize = 0,
+        HistoricUsage = ALL_FEATURES, unsigned long historicSize = 0);
+
+    virtual ~FeatureFileReaderAudio();
+
+    /// Returns the number of complete frames in the audio file
+    /// @exception IOException if an I/O error occurs
+    /// @exception FileNotFoundException
+    ///
+    virtual unsigned long getFeatureCount();
+
+    virtual unsigned long getVectSize();
+    virtual const FeatureFlags& getFeatureFlags();
+    virtual real_t getSampleRate();
+
+    virtual String getClassName() const;
+
+  private :
+
+    bool operator==(const FeatureFileReaderAudio&)
+                         const; /*!Not implemented*/
+    bool operator!=(const FeatureFileReaderAudio&)
+                         const; /*!Not implemented*/
+    const FeatureFileReaderAudio& operator=(
+             const FeatureFileReaderAudio&); /*!Not implemented*/
+    FeatureFileReaderAudio(
+             const FeatureFileReaderAudio&); /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_FeatureFileReaderAudio_h)
@@ -68,6 +68,7 @@
 #include "FeatureFileReaderAbstract.h"
 #include "Feature.h"
 #include "RealVector.h"
+#include "ULongVector.h"
 
 namespace alize
 {
@@ -95,6 +96,12 @@ namespace alize
     virtual void close();
 
     virtual bool readFeature(Feature&, unsigned long step = 1);
+    virtual unsigned long readFeatures(FeatureBlock& b,
+                                       unsigned long maxCount);
+    virtual bool readSelectedFeature(Feature& f,
+                 const ULongVector& selection, unsigned long step = 1);
+    virtual unsigned long readSelectedFeatures(FeatureBlock& b,
+                 unsigned long maxCount, const ULongVector& selection);
     virtual bool addFeature(const Feature& f);
     virtual bool writeFeature(const Feature& f, unsigned long step = 1);
     virtual unsigned long getSourceCount();
@@ -125,6 +132,7 @@ namespace alize
     unsigned long   _nbStored;
     FloatVector*    _pBuffer;
     Feature         _f;
+    long            _labelCode; // label code of the source, -1 if unknown
 
     String getPath(const FileName&, const Config&) const;
     String getExt(const FileName&, const Config&) const;
@@ -134,6 +142,19 @@ namespace alize
 
     virtual unsigned long getHeaderLength();
     bool featureWantedIsInHistoric() const;
+    void loadBuffer(unsigned long featureCount, unsigned long blockSize);
+    bool readOne(Feature& f, unsigned long step,
+                 const ULongVector* pSelection);
+    unsigned long readBlock(FeatureBlock& b, unsigned long maxCount,
+                            const ULongVector* pSelection);
+    void setSelectionRuns(const ULongVector& selection);
+    void copySelectedData(const float* src, Feature::data_t* dst,
+                          unsigned long featureCount);
+
+    ULongVector     _selection; // last selection cut into runs
+    ULongVector     _selectionRuns;
+    unsigned long   _selectionSize;
+    unsigned long getSourceLabelCode();
   };
 
 } // end namespace alize
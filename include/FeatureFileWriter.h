@@ -70,6 +70,7 @@
 namespace alize
 {
   class Feature;
+  class FeatureBlock;
   class Config;
 
   /*!
@@ -77,6 +78,8 @@ namespace alize
   In the RAW format, the dimension of the features is not saved. Each data
   of each feature is saved as a double float value (8 bytes).
   In the SPRO formats, the flags comes from the configuration.
+  The data are saved in big endian if the parameter
+  saveFeatureFileBigEndian is true.
   A raw file can be read using a FeatureFileReaderRaw object.\n
   
   @author Frederic Wils  frederic.wils@lia.univ-avignon.fr
@@ -122,6 +125,14 @@ namespace alize
     ///
     virtual void writeFeature(const Feature& feature);
 
+    /// Write all the features of a block to the file
+    /// @param b the block to save
+    /// @exception IOException if an I/O error occurs
+    /// @exception Exception if the vectSize of the block does not match
+    ///      previous features
+    ///
+    virtual void writeFeatures(const FeatureBlock& b);
+
     virtual String getClassName() const;
 
   private :
@@ -134,6 +145,7 @@ namespace alize
     const Config&           _config;
 
     String getFullFileName(const Config& c, const String& n) const;
+    void writeHeader(unsigned long vectSize);
     FeatureFileWriter(const FeatureFileWriter&);   /*!Not implemented*/
     const FeatureFileWriter& operator=(
                 const FeatureFileWriter&); /*!Not implemented*/
@@ -74,6 +74,8 @@ namespace alize
   class Feature;
   class LabelServer;
   class Config;
+  class FeatureBlock;
+  class ULongVector;
   
   /*!
   Abstract class for a feature input stream. <FRANCAIS> \n
@@ -126,6 +128,44 @@ namespace alize
     ///
     virtual bool readFeature(Feature& f, unsigned long s = 1) = 0;
 
+    /// Reads up to maxCount features from the current position into a
+    /// block and moves the pointer forward. Fewer features can be
+    /// returned before the end of the stream (e.g. at the end of a
+    /// source). The default implementation calls readFeature() for each
+    /// feature ; derived classes copy whole blocks when they can.
+    /// @param b the block to store the data read
+    /// @param maxCount maximum number of features to read
+    /// @return the number of features read, 0 at the end of the stream
+    /// @exception IOException if an I/O error occurs
+    ///
+    virtual unsigned long readFeatures(FeatureBlock& b,
+                                       unsigned long maxCount);
+
+    /// Reads a feature like readFeature() but keeps only the components
+    /// listed in selection. The default implementation reads the whole
+    /// feature and copies the selected components ; file readers gather
+    /// them directly from their buffer.
+    /// @param f the feature to store the selected data
+    /// @param selection indices of the components to keep, in increasing
+    ///     order
+    /// @param s step (default value = 1)
+    /// @return false if there is no more data
+    /// @exception Exception if a selected component is outside of the
+    ///     feature vector
+    ///
+    virtual bool readSelectedFeature(Feature& f,
+                 const ULongVector& selection, unsigned long s = 1);
+
+    /// Block version of readSelectedFeature()
+    /// @param b the block to store the selected data
+    /// @param maxCount maximum number of features to read
+    /// @param selection indices of the components to keep, in increasing
+    ///     order
+    /// @return the number of features read, 0 at the end of the stream
+    ///
+    virtual unsigned long readSelectedFeatures(FeatureBlock& b,
+                 unsigned long maxCount, const ULongVector& selection);
+
     /// adds a feature in the buffer is enougth memory have been allocated by 
     /// featureServerMemAlloc option
     /// @param f the feature to add in the buffer
@@ -242,6 +282,7 @@ namespace alize
 
   private :
     const Config* _pConfig;
+    Feature*      _pFullFeature; // for readSelectedFeature()
   };
 
 } // end namespace alize
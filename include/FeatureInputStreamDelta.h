@@ -0,0 +1,193 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_FeatureInputStreamDelta_h)
+#define ALIZE_FeatureInputStreamDelta_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "FeatureInputStream.h"
+#include "alizeString.h"
+#include "Feature.h"
+#include "FeatureBlock.h"
+#include "FeatureFlags.h"
+#include "RealVector.h"
+#include "RefVector.h"
+
+namespace alize
+{
+  /*!
+  Feature stream which appends the deltas (and optionally the
+  delta-deltas) to the features of its input stream while they are
+  read.<br>
+  Deltas are computed by regression over +/- w frames :
+  d(t) = sum_k k.(x(t+k)-x(t-k)) / (2.sum_k k^2), k = 1..w,
+  the first/last feature of a source being repeated at its bounds.
+  Delta-deltas are the deltas of the deltas. The output vector is
+  [x d dd] which matches the SPro layout of the feature flags
+  (S E D DE DD DDE).<br>
+  The input features are kept in a ring buffer of 4w+1 features
+  (2w+1 without delta-deltas) so each input feature is read once
+  when reading sequentially.
+
+  @version 1.0
+  @date 2010
+  */
+
+  class ALIZE_API FeatureInputStreamDelta : public FeatureInputStream
+  {
+
+  public :
+
+    /// Build the object
+    /// @param is the input feature stream
+    /// @param window half size w of the regression window
+    /// @param useDD false to compute the deltas only
+    /// @param ownStream true if the input stream must be deleted with
+    ///        this object
+    ///
+    FeatureInputStreamDelta(FeatureInputStream& is,
+                     unsigned long window = 2, bool useDD = true,
+                     bool ownStream = false);
+    static FeatureInputStreamDelta& create(FeatureInputStream& is,
+                     unsigned long window = 2, bool useDD = true,
+                     bool ownStream = false);
+
+    virtual bool addFeature(const Feature& f);
+
+    virtual bool readFeature(Feature& f, unsigned long step = 1);
+
+    virtual unsigned long readFeatures(FeatureBlock& b,
+                                       unsigned long maxCount);
+
+    virtual unsigned long getFeatureCount();
+
+    /// Returns the size of the input vectors multiplied by 2 (or 3 with
+    /// delta-deltas)
+    ///
+    virtual unsigned long getVectSize();
+
+    /// Returns the flags of the input stream with useD, useDE (if useE),
+    /// useDD and useDDE (if useE) set
+    /// @exception Exception if the input stream already has deltas
+    ///
+    virtual const FeatureFlags& getFeatureFlags();
+
+    virtual real_t getSampleRate();
+    virtual void reset();
+    virtual void close();
+    virtual unsigned long getSourceCount();
+    virtual unsigned long getFeatureCountOfASource(unsigned long srcIdx);
+    virtual unsigned long getFeatureCountOfASource(const String& src);
+    virtual unsigned long getFirstFeatureIndexOfASource(unsigned long srcIdx);
+    virtual unsigned long getFirstFeatureIndexOfASource(const String& src);
+    virtual const String& getNameOfASource(unsigned long srcIdx);
+    virtual void seekFeature(unsigned long featureNbr,
+                             const String& srcName = "");
+
+    virtual ~FeatureInputStreamDelta();
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private:
+
+    FeatureInputStream* _pInput;
+    unsigned long       _window;
+    bool                _useDD;
+    bool                _ownStream;
+    double              _norm;       // 1/(2.sum_k k^2)
+    FeatureFlags        _flags;
+    RefVector<Feature>  _staticRing; // features [_sBegin, _sEnd)
+    DoubleVector        _deltaRing;  // deltas [_dBegin, _dEnd)
+    unsigned long       _inVectSize;
+    unsigned long       _sBegin;
+    unsigned long       _sEnd;
+    unsigned long       _dBegin;
+    unsigned long       _dEnd;
+    bool                _winValid;
+    unsigned long       _pos;        // next feature to read
+    unsigned long       _inputIdx;   // next feature read by the input
+    unsigned long       _srcFirst;   // bounds of the current source
+    unsigned long       _srcEnd;
+
+    bool locateSource(unsigned long idx);
+    bool readInput(unsigned long idx, Feature& f);
+    bool fillWindows();
+    unsigned long clipBegin(unsigned long idx, unsigned long w) const;
+    unsigned long clipEnd(unsigned long idx, unsigned long w) const;
+    Feature& staticFeature(unsigned long idx);
+    double* deltaData(unsigned long idx);
+    void computeDelta(unsigned long idx, double* out);
+    void computeDeltaDelta(unsigned long idx, Feature::data_t* out);
+    void computeOutput(Feature::data_t* out);
+    void resolveSeek();
+
+    FeatureInputStreamDelta(const FeatureInputStreamDelta&);
+                                                  /* not implemented */
+    const FeatureInputStreamDelta& operator=(
+            const FeatureInputStreamDelta&); /* not implemented */
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_FeatureInputStreamDelta_h)
@@ -116,6 +116,9 @@ namespace alize
 
     virtual bool readFeature(Feature& f, unsigned long step = 1);
 
+    virtual unsigned long readFeatures(FeatureBlock& b,
+                                       unsigned long maxCount);
+
     virtual bool writeFeature(const Feature& f, unsigned long step = 1);
 
     /// Returns the number of features in the file.
@@ -0,0 +1,183 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_FeatureInputStreamNormalizer_h)
+#define ALIZE_FeatureInputStreamNormalizer_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "FeatureInputStream.h"
+#include "alizeString.h"
+#include "Feature.h"
+#include "FeatureBlock.h"
+#include "FrameAccGD.h"
+#include "RealVector.h"
+#include "RefVector.h"
+
+namespace alize
+{
+  /*!
+  Feature stream which normalizes the features of its input stream
+  (cepstral mean or mean/variance normalization) while they are read.<br>
+  With a window of w frames, each feature is normalized with the mean
+  and variance of the 2*(w/2)+1 features centered on it, w/2 on each
+  side (clipped to the bounds of its source) : an even window w
+  actually spans w+1 features and an odd one w features. The window is
+  slid by a FrameAccGD (accumulate/deaccumulate) so the cost is
+  O(vectSize) per feature and only w/2 features are read ahead.<br>
+  With a window of 0, each source (file) is normalized with its own
+  global mean/variance : the source is read once to compute them before
+  its first feature is returned, then read again from its beginning.
+  The input must be able to seek back (reader with an historic
+  ALL_FEATURES or long enough) : a feature out of the historic of the
+  input is not normalized, the reading fails with the error
+  FEATURE_OUT_OF_HISTORY.
+
+  @version 1.0
+  @date 2010
+  */
+
+  class ALIZE_API FeatureInputStreamNormalizer : public FeatureInputStream
+  {
+
+  public :
+
+    /// Build the object
+    /// @param is the input feature stream
+    /// @param useVariance false to normalize the mean only
+    /// @param window size of the sliding window (0 : whole source),
+    ///        rounded to the odd size 2*(window/2)+1
+    /// @param ownStream true if the input stream must be deleted with
+    ///        this object
+    ///
+    FeatureInputStreamNormalizer(FeatureInputStream& is,
+                     bool useVariance = true, unsigned long window = 0,
+                     bool ownStream = false);
+    static FeatureInputStreamNormalizer& create(FeatureInputStream& is,
+                     bool useVariance = true, unsigned long window = 0,
+                     bool ownStream = false);
+
+    virtual bool addFeature(const Feature& f);
+
+    virtual bool readFeature(Feature& f, unsigned long step = 1);
+
+    virtual unsigned long readFeatures(FeatureBlock& b,
+                                       unsigned long maxCount);
+
+    virtual unsigned long getFeatureCount();
+    virtual unsigned long getVectSize();
+    virtual const FeatureFlags& getFeatureFlags();
+    virtual real_t getSampleRate();
+    virtual void reset();
+    virtual void close();
+    virtual unsigned long getSourceCount();
+    virtual unsigned long getFeatureCountOfASource(unsigned long srcIdx);
+    virtual unsigned long getFeatureCountOfASource(const String& src);
+    virtual unsigned long getFirstFeatureIndexOfASource(unsigned long srcIdx);
+    virtual unsigned long getFirstFeatureIndexOfASource(const String& src);
+    virtual const String& getNameOfASource(unsigned long srcIdx);
+    virtual void seekFeature(unsigned long featureNbr,
+                             const String& srcName = "");
+
+    virtual ~FeatureInputStreamNormalizer();
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private:
+
+    FeatureInputStream* _pInput;
+    bool                _useVariance;
+    unsigned long       _window;
+    bool                _ownStream;
+    FrameAccGD          _acc;
+    RefVector<Feature>  _ring;       // features [_winBegin, _winEnd)
+    Feature             _feature;
+    unsigned long       _winBegin;
+    unsigned long       _winEnd;
+    bool                _winValid;   // false : _acc must be rebuilt
+    unsigned long       _pos;        // next feature to read
+    unsigned long       _inputIdx;   // next feature read by the input
+    unsigned long       _srcFirst;   // bounds of the current source
+    unsigned long       _srcEnd;
+    DoubleVector        _meanVect;
+    DoubleVector        _invStdVect;
+
+    bool locateSource(unsigned long idx);
+    bool readInput(unsigned long idx, Feature& f);
+    bool computeGlobalStat();
+    bool slideWindow();
+    void computeStat();
+    void normalize(Feature::data_t* data);
+    bool nextFeature(const Feature*& p);
+    void resolveSeek();
+    Feature& ringFeature(unsigned long idx);
+
+    FeatureInputStreamNormalizer(const FeatureInputStreamNormalizer&);
+                                                  /* not implemented */
+    const FeatureInputStreamNormalizer& operator=(
+            const FeatureInputStreamNormalizer&); /* not implemented */
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_FeatureInputStreamNormalizer_h)
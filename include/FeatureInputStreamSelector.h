@@ -0,0 +1,191 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_FeatureInputStreamSelector_h)
+#define ALIZE_FeatureInputStreamSelector_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "FeatureInputStream.h"
+#include "alizeString.h"
+#include "Feature.h"
+#include "FeatureBlock.h"
+#include "ULongVector.h"
+
+namespace alize
+{
+  class SegCluster;
+  class Seg;
+
+  /*!
+  Feature stream which keeps only the frames of its input stream whose
+  coefficient #coef (c0/energy by default) is greater than or equal to a
+  threshold. The criterion is evaluated while the frames are read, so the
+  input is read only once. The selected frames are numbered 0,1,2...
+  like in any stream ; the indices of the input frames are kept so that
+  seekFeature() and getFeatureCount() do not need a second pass.<br>
+  Optionally, the runs of selected frames are stored as segments in a
+  cluster of a SegServer (see setSegCluster()).
+
+  @version 1.0
+  @date 2010
+  */
+
+  class ALIZE_API FeatureInputStreamSelector : public FeatureInputStream
+  {
+
+  public :
+
+    /// Build the object
+    /// @param is the input feature stream
+    /// @param coef index of the coefficient tested
+    /// @param threshold frames with a coefficient lower than this value
+    ///        are dropped
+    /// @param ownStream true if the input stream must be deleted with
+    ///        this object
+    ///
+    FeatureInputStreamSelector(FeatureInputStream& is, unsigned long coef,
+                     real_t threshold, bool ownStream = false);
+    static FeatureInputStreamSelector& create(FeatureInputStream& is,
+                     unsigned long coef, real_t threshold,
+                     bool ownStream = false);
+
+    /// Asks the stream to store the runs of selected frames as segments
+    /// of a cluster. Begin of a segment is relative to its source and
+    /// the source name is stored in the segment. Only the frames
+    /// examined after this call are stored.
+    /// @param c the cluster (usually created by a SegServer)
+    /// @param lc label code of the new segments
+    ///
+    void setSegCluster(SegCluster& c, unsigned long lc = 0);
+
+    virtual bool addFeature(const Feature& f);
+
+    virtual bool readFeature(Feature& f, unsigned long step = 1);
+
+    /// Reads blocks from the input stream and keeps the selected
+    /// features when the stream is read sequentially
+    ///
+    virtual unsigned long readFeatures(FeatureBlock& b,
+                                       unsigned long maxCount);
+
+    /// Returns the number of selected features. Reads the end of the
+    /// input stream if it has not been read yet.
+    /// @return the number of selected features
+    /// @exception IOException if an I/O error occurs
+    ///
+    virtual unsigned long getFeatureCount();
+
+    virtual unsigned long getVectSize();
+    virtual const FeatureFlags& getFeatureFlags();
+    virtual real_t getSampleRate();
+    virtual void reset();
+    virtual void close();
+    virtual unsigned long getSourceCount();
+    virtual unsigned long getFeatureCountOfASource(unsigned long srcIdx);
+    virtual unsigned long getFeatureCountOfASource(const String& src);
+    virtual unsigned long getFirstFeatureIndexOfASource(unsigned long srcIdx);
+    virtual unsigned long getFirstFeatureIndexOfASource(const String& src);
+    virtual const String& getNameOfASource(unsigned long srcIdx);
+    virtual void seekFeature(unsigned long featureNbr,
+                             const String& srcName = "");
+
+    virtual ~FeatureInputStreamSelector();
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private:
+
+    FeatureInputStream* _pInput;
+    unsigned long       _coef;
+    real_t              _threshold;
+    bool                _ownStream;
+    Feature             _feature;
+    unsigned long       _featureIdx;  // input index of _feature
+    ULongVector         _selected;    // input indices of selected frames
+    unsigned long       _scanIdx;     // next input frame to examine
+    bool                _scanEnded;
+    unsigned long       _inputIdx;    // next frame read by the input
+    unsigned long       _pos;         // next selected frame to read
+    SegCluster*         _pSegCluster;
+    unsigned long       _segLabelCode;
+    Seg*                _pLastSeg;
+    unsigned long       _srcIdx;      // next source for the segments
+    unsigned long       _srcFirst;
+    unsigned long       _srcEnd;
+
+    bool scanNextFeature();
+    void scanUntil(unsigned long inputIdx);
+    unsigned long countSelectedBefore(unsigned long inputIdx) const;
+    unsigned long findSource(const String& src);
+    void addToSegCluster(unsigned long inputIdx);
+
+    FeatureInputStreamSelector(const FeatureInputStreamSelector&);
+                                                  /* not implemented */
+    const FeatureInputStreamSelector& operator=(
+            const FeatureInputStreamSelector&); /* not implemented */
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_FeatureInputStreamSelector_h)
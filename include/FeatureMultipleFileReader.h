@@ -127,6 +127,12 @@ namespace alize
     virtual bool addFeature(const Feature& f);
 
     virtual bool readFeature(Feature& f, unsigned long step = 1);
+    virtual unsigned long readFeatures(FeatureBlock& b,
+                                       unsigned long maxCount);
+    virtual bool readSelectedFeature(Feature& f,
+                 const ULongVector& selection, unsigned long step = 1);
+    virtual unsigned long readSelectedFeatures(FeatureBlock& b,
+                 unsigned long maxCount, const ULongVector& selection);
 
     virtual bool writeFeature(const Feature& f, unsigned long step = 1);
 
@@ -227,7 +233,10 @@ namespace alize
     FeatureFileReader** createReaderPtrVect();
     FloatVector**       createBufferPtrVect();
     FeatureFileReader&  getReader(unsigned long idx);
-    bool                rw(bool, Feature&, unsigned long);
+    bool                rw(bool, Feature&, unsigned long,
+                           const ULongVector* pSelection);
+    unsigned long readBlock(FeatureBlock& b, unsigned long maxCount,
+                            const ULongVector* pSelection);
     bool                featureWantedIsInHistoric(unsigned long n) const;
 
     bool operator==(const FeatureMultipleFileReader&)
@@ -231,6 +231,15 @@ namespace alize
     ///    
     virtual bool readFeature(Feature& f, unsigned long s = 1);
 
+    /// Reads a block of features
+    /// @param b the block to store the data read
+    /// @param maxCount maximum number of features to read
+    /// @return the number of features read, 0 if end of stream met.
+    ///    See FeatureInputStream::readFeatures()
+    ///
+    virtual unsigned long readFeatures(FeatureBlock& b,
+                                       unsigned long maxCount);
+
     /// adds a feature
     /// @param f the feature to store the data read
     /// @return false not possible to add feature
@@ -152,6 +152,17 @@ namespace alize
     /// @exception EOFException if end of file has been reached
     ///
     unsigned long readUInt4();
+
+    /// Reads the word written by FileWriter::writeByteOrderCheck() and
+    /// sets swap() if the file was written with the other byte order.
+    /// The next read methods then swap the values, except
+    /// readSomeBytes() : the caller swaps the bytes itself (ByteSwap)
+    /// @exception InvalidDataException if the word is not a byte order
+    ///            check word
+    /// @exception IOException if an I/O error occurs
+    /// @exception EOFException if end of file has been reached
+    ///
+    void readByteOrderCheck();
     
     /// Reads eight input bytes
     /// @return the double value
@@ -183,6 +194,15 @@ namespace alize
     /// @exception IOException if an I/O error occurs
     ///
     unsigned long readSomeFloats(FloatVector& v);
+
+    /// Tries to read length bytes. Fewer bytes are read at the end of
+    /// the file. The bytes are not swapped.
+    /// @param buffer the memory area to fill
+    /// @param length number of bytes to read
+    /// @return the number of bytes read
+    /// @exception IOException if an I/O error occurs
+    ///
+    unsigned long readSomeBytes(void* buffer, unsigned long length);
     
     /// Reads the next line of text from the input stream. It reads
     /// successive bytes until it encounters a line terminator or end of
@@ -72,7 +72,10 @@
 namespace alize
 {
 
-  /// Convenient class used to write data to a file
+  /// Convenient class used to write data to a file.
+  /// The data are stored in an internal buffer which is written to the
+  /// file when it is full, by flush() and when the file is closed.
+  /// Values are byte-swapped when _swap is true.
   ///
   /// @author Frederic Wils  frederic.wils@lia.univ-avignon.fr
   /// @version 1.0
@@ -94,36 +97,35 @@ namespace alize
     virtual String getClassName() const;
     virtual String toString() const;
 
-
-  protected:
-
-    FILE*    _pFileStruct;
-    FileName _fileName;
-    bool     _swap;
-
+    /// Creates (truncates) the file. Must be called before the write
+    /// methods below when the object is used directly to write a binary
+    /// file (counterpart of the read methods of FileReader)
     /// @exception IOException if an I/O error occurs
     ///
     void open();
 
-    /// Tests whether the file is closed 
+    /// @exception IOException if an I/O error occurs
     ///
-    bool isClosed() const;
+    void writeUInt4(unsigned long value);
 
-    /// Tests whether the file is opened 
+    /// @exception IOException if an I/O error occurs
     ///
-    bool isOpen() const;
+    void writeDouble(double value);
 
     /// @exception IOException if an I/O error occurs
     ///
-    void writeUInt4(unsigned long value);
+    void writeFloat(float value);
 
+    /// Writes an array of values
     /// @exception IOException if an I/O error occurs
     ///
-    void writeDouble(double value);
+    void writeDoubles(const double* array, unsigned long n);
+    void writeFloats(const float* array, unsigned long n);
 
+    /// Writes an array of values converted to float
     /// @exception IOException if an I/O error occurs
     ///
-    void writeFloat(float value);
+    void writeFloats(const double* array, unsigned long n);
 
     /// @exception IOException if an I/O error occurs
     ///
@@ -137,6 +139,33 @@ namespace alize
     ///
     void writeString(const String& string);
 
+    /// Writes the 4 bytes word from which
+    /// FileReader::readByteOrderCheck() detects a file written with the
+    /// other byte order
+    /// @exception IOException if an I/O error occurs
+    ///
+    void writeByteOrderCheck();
+
+
+  protected:
+
+    FILE*    _pFileStruct;
+    FileName _fileName;
+    bool     _swap;
+
+    /// Writes the buffered data to the file
+    /// @exception IOException if an I/O error occurs
+    ///
+    void flush();
+
+    /// Tests whether the file is closed 
+    ///
+    bool isClosed() const;
+
+    /// Tests whether the file is opened 
+    ///
+    bool isOpen() const;
+
     /// @exception IOException if an I/O error occurs
     ///
     void writeAttribute(const String& name, const String& value);
@@ -151,6 +180,13 @@ namespace alize
 
   private :
 
+    char*         _pBuffer;
+    unsigned long _bufferSize; // bytes stored in _pBuffer
+
+    void write(const void* p, unsigned long length);
+    void writeValue(const void* p, unsigned long size);
+    unsigned long getBufferSpace(unsigned long itemSize, unsigned long n);
+
     FileWriter(const FileWriter&); /*!Not implemented*/
     const FileWriter& operator=(const FileWriter&); /*!Not implemented*/
     bool operator==(const FileWriter&) const; /*!Not implemented*/
@@ -134,6 +134,13 @@ namespace alize
     ///
     void descendingSort() const;
 
+    /// Moves the k greatest elements to the beginning of the vector,
+    /// sorted in descending order. The order of the other elements is
+    /// undefined. Much faster than descendingSort() when k is small.
+    /// @param k number of elements to select
+    ///
+    void descendingSort(unsigned long k) const;
+
     /// Use this method to access directly to the internal vector
     /// @return a pointer on the first element
     /// @warning Fast but dangerous ! Use preferably operator [].
@@ -156,6 +163,7 @@ namespace alize
 
     type* createArray() const;
     static int compare(const void*, const void*);
+    static bool greater(const type&, const type&);
 
 
     bool operator==(const LKVector&) const;
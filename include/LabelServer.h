@@ -68,6 +68,9 @@
 #include "Object.h"
 #include "RefVector.h"
 #include "Label.h"
+#include "alizeString.h"
+using alize::String; // before #include <map>
+#include <map>
 
 namespace alize
 {
@@ -108,6 +111,9 @@ namespace alize
     /// existe dj
     /// @param l The object to add. The Label object stored is a copy
     ///    of this parameter.\n
+    /// </FRANCAIS>
+    /// The search for an identical label goes through an index and
+    /// costs O(log(size())).
     /// @param forceAdd force the add of the label
     /// @return the index of the label
     ///
@@ -129,7 +135,8 @@ namespace alize
     ///
     Label& getLabel(unsigned long index) const;
 
-    /// Find and returns the index of a label
+    /// Find and returns the index of a label. The search uses an index
+    /// and costs O(log(size()))
     /// @param s the string used as a key to search the label
     /// @return the index of the label if it exists; -1 otherwise
     ///
@@ -152,9 +159,20 @@ namespace alize
 
   private :
 
+    typedef std::pair<String, String> key_t; /*! string, source name */
+
     unsigned long   _first; /*! index of the first non-predefined label */
     unsigned long   _lastAdded;/*! index of the last label added*/
     RefVector<Label> _vect;
+    /*! index of the first label for each (string, source name) */
+    mutable std::map<key_t, unsigned long> _map;
+    /*! index of the first label for each string */
+    mutable std::map<String, unsigned long> _stringMap;
+    mutable bool    _indexIsValid;
+
+    long findLabel(const Label&) const;
+    void indexLabel(unsigned long index) const;
+    void indexLabels() const;
 
     LabelServer(const LabelServer&); /*! Not implemented */
     const LabelServer& operator=(const LabelServer&); /*! Not implemented*/
@@ -67,6 +67,7 @@
 
 #include "Object.h"
 #include "RefVector.h"
+#include "ULongVector.h"
 #include "alizeString.h"
 using alize::String; // before #include <map>
 #include <map>
@@ -117,6 +118,35 @@ namespace alize
     ///
     void deleteMixture(const Mixture& m);
 
+    /// Deletes a mixture. The last mixture is moved to its index, so
+    /// the cost does not depend on the number of mixtures.
+    /// @param index index of the mixture
+    /// @exception IndexOutOfBoundsException
+    ///
+    void deleteMixtureFast(unsigned long index);
+
+    /// Inserts a mixture in the least recently used list of the
+    /// mixtures loaded on demand. It becomes the most recently used.
+    /// @param index index of the mixture
+    /// @param memory memory used by the mixture (bytes)
+    ///
+    void setCached(unsigned long index, unsigned long memory);
+
+    /// Marks a mixture as the most recently used if it is in the least
+    /// recently used list. Does nothing otherwise.
+    /// @param index index of the mixture
+    ///
+    void touch(unsigned long index) const;
+
+    /// @return the index of the least recently used mixture loaded on
+    ///         demand. Returns -1 if there is no such mixture
+    ///
+    long getLeastRecentlyUsed() const;
+
+    /// @return the memory used by the mixtures loaded on demand (bytes)
+    ///
+    unsigned long getCachedMemory() const;
+
     void clear();
 
     unsigned long size() const;
@@ -131,6 +161,20 @@ namespace alize
     // map = conteneur associatif  cls uniques
     std::map<String, unsigned long>::iterator _it;
     RefVector<Mixture> _vect;
+    // least recently used list of the mixtures loaded on demand
+    // (doubly linked through the indexes of _vect)
+    mutable ULongVector _lruPrevVect;
+    mutable ULongVector _lruNextVect;
+    ULongVector         _memVect; // 0 if not in the list
+    mutable unsigned long _lruFirst; // least recently used
+    mutable unsigned long _lruLast;  // most recently used
+    unsigned long       _cachedMemory;
+
+    void unlink(unsigned long) const;
+    void linkLast(unsigned long) const;
+    void getLRUOrder(RefVector<Mixture>&, ULongVector&,
+                     unsigned long f, unsigned long l) const;
+    void setLRUOrder(const RefVector<Mixture>&, const ULongVector&);
   
     MixtureDict(const MixtureDict&); /*!Not implemented*/
     const MixtureDict& operator=(const MixtureDict&);/*!Not implemented*/
@@ -71,6 +71,7 @@
 namespace alize
 {
   class Config;
+  class LKVector;
 
   /// Class used to make specific calculation in a MixtureGD object
   /// and to store and accumulate results
@@ -90,28 +91,100 @@ namespace alize
                                  const MixtureGD& m, const Config&);
     virtual ~MixtureGDStat();
 
+    /// Prepares a new EM accumulation. The accumulators and the output
+    /// mixture are allocated by the first call and reused (zeroed or
+    /// overwritten in place) by the next ones, so a single object can be
+    /// recycled across many speakers without heap traffic.
+    ///
     virtual void resetEM();
 
     /// @return sum of occupations BEFORE normalization
     virtual occ_t computeAndAccumulateEM(const Feature&, double w = 1.0);
 
     virtual void addAccEM(const MixtureStat&);
+    using MixtureStat::addAccEM;
 
     virtual const Mixture& getEM();
 
-    /// Returns the internal mixture used to accumulate data for EM
+    /// Returns the mixture in which the data are accumulated for EM
+    /// (sums in the mean vectors, sums of squares in the covariance
+    /// vectors). The mixture is owned by this object.
     /// @return the internal mixture used to accumulate data for EM
     /// @exception Exception if resetEM() have not been called beforehand
     ///
     MixtureGD& getInternalAccumEM(); /* NOT VIRTUAL */
 
+    // -------------------------- MAP ---------------------------
+
+    /// Resets the statistics used for MAP adaptation of the mixture.
+    /// Only the statistics needed by the mode are accumulated : the
+    /// sums of squares are skipped unless the covariances are adapted.
+    /// Shares its workspace with EM, so it cancels a previous resetEM().
+    /// @param mode the parameters to adapt
+    ///
+    void resetMAP(MAPAdaptMode mode = MAPAdaptMode_MEAN);
+
+    /// Accumulates the MAP statistics of a feature
+    /// @param f the feature
+    /// @param w the weight of the feature
+    /// @return sum of occupations BEFORE normalization
+    /// @exception Exception if resetMAP() have not been called beforehand
+    ///
+    occ_t computeAndAccumulateMAP(const Feature& f, double w = 1.0);
+
+    /// Same as computeAndAccumulateMAP(f, w) but the posteriors are
+    /// computed over the top distributions only (the first
+    /// topDistribsCount elements of the vector, see
+    /// StatServer::getTopDistribIndexVector() and TopDistribsCache).
+    /// The other distributions get a null occupation.
+    /// @param f the feature
+    /// @param topDistribs the top distributions of the feature
+    /// @param w the weight of the feature
+    /// @return sum of occupations BEFORE normalization
+    /// @exception Exception if resetMAP() have not been called beforehand
+    ///
+    occ_t computeAndAccumulateMAP(const Feature& f,
+                                  const LKVector& topDistribs, double w = 1.0);
+
+    /// Writes in a mixture the MAP adaptation of the mixture of this
+    /// object (the prior) to the accumulated data. The parameters not
+    /// adapted are copied from the prior. The destination can be the
+    /// prior itself.
+    /// @param m the destination mixture
+    /// @param meanRelevance relevance factor of the means
+    /// @param weightRelevance relevance factor of the weights
+    /// @param covRelevance relevance factor of the covariances
+    /// @exception Exception if resetMAP() have not been called beforehand
+    ///   or if m has not the same size as the prior
+    ///
+    void adaptMAP(MixtureGD& m, real_t meanRelevance,
+                  real_t weightRelevance, real_t covRelevance) const;
+
+    /// Same as adaptMAP(m, r, r, r)
+    ///
+    void adaptMAP(MixtureGD& m, real_t relevance) const;
+
     virtual String getClassName() const;
   
   
   private :
 
-    MixtureGD* _pMixForAccumulation;
+    MixtureGD* _pMixForAccumulation; /*!< accumulators of EM and MAP :
+                 sums of data in the means, sums of squares in the covs */
     MixtureGD* _pMixtureForEM;
+    mutable DoubleVector _covWorkVect; /*!< vectSize covariances used by
+                                            getEM() and adaptMAP() */
+    bool _resetedMAP;
+    MAPAdaptMode _mapMode;
+
+    void resetAccumulators(bool cov);
+    real_t* getAccMeanArray(unsigned long c) const;
+    real_t* getAccCovArray(unsigned long c) const;
+    void accumulateMAP(const real_t* data, unsigned long c);
+    void assertResetMAPDone() const;
+
+    virtual void getAccEMArrays(unsigned long c, real_t*& mean,
+                       real_t*& cov, unsigned long& covSize) const;
 
     MixtureGDStat(const MixtureGDStat&); /*!Not implemented*/
     const MixtureGDStat& operator=(
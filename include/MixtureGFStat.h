@@ -96,6 +96,7 @@ namespace alize
     /// @return sum of occupations BEFORE normalization
     virtual occ_t computeAndAccumulateEM(const Feature&, double w = 1.0);
     virtual void addAccEM(const MixtureStat&);
+    using MixtureStat::addAccEM;
     virtual const Mixture& getEM();
 
     /// Returns the internal mixture used to accumulate data for EM
@@ -112,6 +113,9 @@ namespace alize
     MixtureGF* _pMixForAccumulation;
     MixtureGF* _pMixtureForEM;
 
+    virtual void getAccEMArrays(unsigned long c, real_t*& mean,
+                       real_t*& cov, unsigned long& covSize) const;
+
     MixtureGFStat(const MixtureGFStat&); /*!Not implemented*/
     const MixtureGFStat& operator=(
                 const MixtureGFStat&); /*!Not implemented*/
@@ -83,7 +83,13 @@ namespace alize
   /// Both mixtures and distributions can be accessed by an index.
   /// Mixtures can share the same distributions.
   /// In addition, mixtures can be found using the identifier.
-  /// Each mixture identifier is unique.
+  /// Each mixture identifier is unique.\n
+  /// Concurrent scoring : once the mixtures are loaded (and computeAll()
+  /// called on their distributions), several threads can compute
+  /// likelihoods with the same server if each thread uses its own
+  /// StatServer. The server and its mixtures must not be modified
+  /// meanwhile and the on demand loading (parameter
+  /// "mixtureServerCacheMemAlloc") must not be used.
   ///
   /// @author Frederic Wils  frederic.wils@lia.univ-avignon.fr
   /// @version 1.0
@@ -439,9 +445,20 @@ namespace alize
     unsigned long getMixtureCount() const;
 
     /// Tests whether a mixture with a particular identifier exists inside
-    /// the server
+    /// the server.\n
+    /// If the parameter "mixtureServerCacheMemAlloc" is defined and not
+    /// 0, a mixture which is not in the server is loaded on demand from
+    /// the file named id (see loadMixture(...)). The least recently used
+    /// mixtures loaded on demand are then deleted (with their
+    /// distributions not used by other mixtures) until their memory
+    /// fits in mixtureServerCacheMemAlloc bytes. The last mixture of
+    /// the server is moved to the index of a deleted mixture.
     /// @param id identifier to find
     /// @return the index of the mixture if it exists; -1 otherwise
+    /// @warning with on demand loading, an index or a reference on a
+    ///    mixture loaded on demand is valid only until the next call to
+    ///    this method (do not keep statistics on such a mixture in a
+    ///    StatServer across calls)
     ///
     long getMixtureIndex(const String& id) const;
 
@@ -475,6 +492,20 @@ namespace alize
     ///
     void save(const FileName& f) const;
 
+    /// Copies in this server all the distributions and mixtures of another
+    /// server. The distributions shared by several mixtures stay shared and
+    /// the mixtures keep their identifiers (a suffix " #n" is added if
+    /// the identifier already exists in this server).\n
+    /// The copies are written by the calling thread. Called by a thread
+    /// bound to a NUMA node (see Numa::bindThreadToNode()), the data are
+    /// placed in the memory of that node : create one server per node
+    /// and replicate the same source in each of them. Several threads can
+    /// replicate the same source at the same time if the source is not
+    /// modified meanwhile.
+    /// @param s the source server
+    ///
+    void replicate(const MixtureServer& s);
+
     virtual String getClassName() const;
     virtual String toString() const;
 
@@ -493,6 +524,9 @@ namespace alize
     void addMixtureToDict(Mixture&);
     String newId();
     Mixture& loadMixture(const FileName& f, DistribType);
+    long loadMixtureOnDemand(const String& id);
+    void deleteMixtureOnDemand(unsigned long index);
+    static unsigned long getMixtureMemory(const Mixture&);
     void autoSetMixtureId(Mixture& m, String id);
 
 
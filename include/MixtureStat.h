@@ -68,6 +68,9 @@
 #include "Object.h"
 #include "StatServer.h"
 #include "RealVector.h"
+#include "ULongVector.h"
+#include "LKVector.h"
+#include "DistribGD.h"
 
 namespace alize
 {
@@ -249,6 +252,31 @@ namespace alize
 
     virtual void addAccEM(const MixtureStat&) = 0;
 
+    /// Saves the EM accumulators (occupations, feature counters and sums
+    /// of the distributions) in a binary file (native byte order, with
+    /// a byte order check word so that addAccEM(const FileName&) reads
+    /// it on a machine with the other byte order).
+    /// The file can be added later with addAccEM(const FileName&), for
+    /// example to reduce on one computer the accumulators computed on
+    /// many others.
+    /// @param f the name of the file
+    /// @exception Exception if resetEM() have not been called beforehand
+    /// @exception IOException if an I/O error occurs
+    ///
+    void saveAccEM(const FileName& f) const;
+
+    /// Adds the EM accumulators saved in a file by saveAccEM(...).
+    /// Call resetEM() first, add as many files as needed then call
+    /// getEM(), or saveAccEM(...) to save a partial reduction.
+    /// @param f the name of the file
+    /// @exception Exception if resetEM() have not been called beforehand
+    /// @exception InvalidDataException if the file does not match this
+    ///    mixture (type, distribution count or vectSize) or its byte
+    ///    order check word is wrong
+    /// @exception IOException if an I/O error occurs
+    ///
+    void addAccEM(const FileName& f);
+
     /// Gets the result of EM accumulation.
     /// @return a constant mixture.
     /// @exception Exception if resetEm() have not been called beforehand
@@ -286,10 +314,37 @@ namespace alize
     StatServer*         _pStatServer;
     real_t              _featureCounterForEM;
 
+    const real_t        _occPruningThreshold;
+    const unsigned long _occPruningTopDistribsCount;
+    ULongVector         _occIndexVect; /*!< distributions with a non null
+                        occupation after the last call to computeOccVect() */
+    LKVector            _occLKVect;    /*!< used to select the top posteriors */
+    const DistribGD::LKKernel _lkKernel; /*!< likelihood kernel of the
+                        mixture if it is a mixture GD, NULL otherwise */
+
+    /// Computes the occupations of a feature in _occVect. If the
+    /// parameter occPruningThreshold or occPruningTopDistribsCount is set,
+    /// the smallest occupations are set to 0.0 and the others are
+    /// normalized again. The indexes of the distributions kept are
+    /// stored in _occIndexVect (all the distributions if no pruning).
+    /// @return sum of occupations BEFORE normalization
+    ///
     real_t computeOccVect(const Feature&);
     void assertResetEMDone() const;
 
+    /// Gives the arrays used to accumulate the sums of a distribution
+    /// for EM (see saveAccEM(...))
+    /// @param c index of the distribution
+    /// @param mean the sum of the features
+    /// @param cov the sum of the squared features
+    /// @param covSize size of the cov array
+    ///
+    virtual void getAccEMArrays(unsigned long c, real_t*& mean,
+                       real_t*& cov, unsigned long& covSize) const = 0;
+
   private:
+    void pruneOccVect();
+
     bool operator==(const MixtureStat&) const;/*!Not implemented*/
     bool operator!=(const MixtureStat&) const;/*!Not implemented*/
     const MixtureStat& operator=(
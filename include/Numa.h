@@ -0,0 +1,114 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_Numa_h)
+#define ALIZE_Numa_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+namespace alize
+{
+  /// NUMA helpers for multi-socket scoring. A typical use is one thread
+  /// per node : each thread calls bindThreadToNode(), replicates the
+  /// models in its own MixtureServer (MixtureServer::replicate()) so
+  /// that they are placed in the local memory, and scores its part of
+  /// the speakers (getPartition()).<br>
+  /// The node topology is read from /sys on Linux. Elsewhere, or on a
+  /// single node machine, there is one node and bindThreadToNode() does
+  /// nothing, which is the usual behaviour.
+  ///
+  /// @version 1.0
+  /// @date 2010
+
+  class ALIZE_API Numa
+  {
+  public :
+
+    /// Returns the number of NUMA nodes having processors
+    /// @return the number of nodes (at least 1)
+    ///
+    static unsigned long getNodeCount();
+
+    /// Restricts the calling thread to the processors of a node. Its
+    /// next allocations are then placed in the memory of the node
+    /// (first touch). Does nothing if there is only one node.
+    /// @param node index of the node (0 to getNodeCount()-1)
+    /// @return false if the thread could not be bound
+    ///
+    static bool bindThreadToNode(unsigned long node);
+
+    /// Splits a set of items (speakers, files...) in nodeCount contiguous
+    /// parts of nearly the same size and returns the part of a node
+    /// @param itemCount number of items
+    /// @param nodeCount number of nodes
+    /// @param node index of the node
+    /// @param first returns the index of the first item of the node
+    /// @param count returns the number of items of the node
+    ///
+    static void getPartition(unsigned long itemCount, unsigned long nodeCount,
+                             unsigned long node, unsigned long& first,
+                             unsigned long& count);
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_Numa_h)
@@ -115,6 +115,12 @@ namespace alize
     DUPL_DISTRIB,
     SHARE_DISTRIB
   };
+  enum MAPAdaptMode
+  {
+    MAPAdaptMode_MEAN,          // adapts the means only
+    MAPAdaptMode_MEAN_WEIGHT,   // adapts the means and the weights
+    MAPAdaptMode_MEAN_WEIGHT_COV  // adapts means, weights and covariances
+  };
   enum DistribType
   {
     DistribType_GD,
@@ -143,6 +149,7 @@ namespace alize
     FeatureFileReaderFormat_SPRO3,
     FeatureFileReaderFormat_SPRO4,
     FeatureFileReaderFormat_HTK,
+    FeatureFileReaderFormat_AUDIO,
   };
 
   enum MixtureFileReaderFormat
@@ -294,9 +301,6 @@ namespace alize
     static const real_t EPS_LK;
     static const real_t PI;
     static const real_t PI2;
-
-  private :
-    static bool _initialized;
   };
 
   //-----------------------------------------------------------------------
@@ -369,6 +373,11 @@ namespace alize
     friend class FeatureFileReader;
     friend class FeatureFileReaderSingle;
     friend class FeatureInputStreamModifier;
+    friend class FeatureInputStreamNormalizer;
+    friend class FeatureInputStreamDelta;
+    friend class FeatureInputStreamSelector;
+    friend class FeatureBlock;
+    friend class FeatureInputStream;
     friend class FeatureServer;
 
   private :
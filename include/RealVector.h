@@ -71,10 +71,12 @@
 #include <cstdlib>
 #include "alizeString.h"
 #include "Exception.h"
+#include "Allocator.h"
 
 namespace alize
 {
   /// This class implements a growable array of real (float/double) values.
+  /// The array is aligned on Allocator::ALIGNMENT bytes.
   ///
   /// @author Frederic Wils  frederic.wils@lia.univ-avignon.fr
   /// @version 1.0
@@ -97,15 +99,28 @@ namespace alize
     ///    overtake the capacity
     ///
     explicit RealVector(unsigned long capacity = 0, unsigned long size = 0)
-    :Object(), _size(0), _capacity(capacity!=0?capacity:1), 
-    _array(createArray())
+    :Object(), _pAllocator(NULL), _size(0),
+    _capacity(capacity!=0?capacity:1), _array(createArray())
     {
       setSize(size);
     }
 
+    /// Same as RealVector(capacity, size) but the memory comes from an
+    /// allocator, for example an ArenaAllocator for temporary vectors.
+    /// The allocator must live longer than the vector.
+    ///
+    RealVector(unsigned long capacity, unsigned long size, Allocator& a)
+    :Object(), _pAllocator(&a), _size(0),
+    _capacity(capacity!=0?capacity:1), _array(createArray())
+    {
+      setSize(size);
+    }
+
+    /// The copy uses the aligned functions of Allocator
+    ///
     RealVector(const RealVector<T>& v)
-    :Object(), _size(v._size), _capacity(v._size!=0?v._size:1),
-    _array(createArray())
+    :Object(), _pAllocator(NULL), _size(v._size),
+    _capacity(v._size!=0?v._size:1), _array(createArray())
     {
       memcpy(_array, v._array, _size*sizeof(_array[0]));
     }
@@ -126,7 +141,7 @@ namespace alize
       _size = v._size;
       if (_capacity < _size)
       {
-        delete[] _array;
+        deallocateArray(_array);
         _capacity = _size!=0?_size:1;
         _array = createArray();
       }
@@ -170,7 +185,7 @@ namespace alize
 
     virtual ~RealVector()
     {
-      delete[] _array;
+      deallocateArray(_array);
     }
 
     unsigned long size() const
@@ -202,7 +217,7 @@ namespace alize
         T* oldArray = _array;
         _array = createArray(); // can throw OutOfMemoryException
         memcpy(_array, oldArray, (size>oldSize?oldSize:size)*sizeof(_array[0]));
-        delete[] oldArray;
+        deallocateArray(oldArray);
         //for (unsigned long i=oldSize; i<_size; i++)
         //  _array[i] = 0.0;
       }
@@ -222,7 +237,7 @@ namespace alize
         T* oldArray = _array;
         _array = createArray(); // can throw OutOfMemoryException
         memcpy(_array, oldArray, _size*sizeof(_array[0]));
-        delete[] oldArray;
+        deallocateArray(oldArray);
       }
       _array[_size] = v;
       _size++;
@@ -358,6 +373,7 @@ namespace alize
 
   private:
 
+    Allocator*    _pAllocator; /*!< NULL for the aligned functions */
     unsigned long _size;
     unsigned long _capacity;
     T*            _array;
@@ -365,10 +381,19 @@ namespace alize
     T* createArray() const
     {
       assert(_capacity != 0);
-      T* p = new (std::nothrow) T[_capacity];
+      const unsigned long s = _capacity*sizeof(T);
+      T* p = static_cast<T*>(_pAllocator != NULL ?
+             _pAllocator->allocate(s) : Allocator::allocateAligned(s));
       assertMemoryIsAllocated(p, __FILE__, __LINE__);
       return p;
     }
+    void deallocateArray(T* p) const
+    {
+      if (_pAllocator != NULL)
+        _pAllocator->deallocate(p);
+      else
+        Allocator::deallocateAligned(p);
+    }
     static int compare(const void* s1, const void* s2)
     {
       if (*((T*)s1) > *((T*)s2))
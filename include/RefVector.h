@@ -74,6 +74,7 @@
 #include <new>
 #include <memory.h>
 #include "Exception.h"
+#include "Allocator.h"
 #include "DoubleSquareMatrix.h"
 #include "Feature.h"
 
@@ -118,7 +119,7 @@ namespace alize
         _size = v._size;
         if (_capacity < _size)
         {
-          delete[] _array;
+          Allocator::deallocateAligned(_array);
           _capacity = _size!=0?_size:1;
           _array = createArray();
         }
@@ -127,7 +128,7 @@ namespace alize
       return *this;
     }
 
-    virtual ~RefVector() { delete[] _array; }
+    virtual ~RefVector() { Allocator::deallocateAligned(_array); }
 
     void clear() { _size = 0; }
 
@@ -142,7 +143,7 @@ namespace alize
       _capacity = newCapacity!=0?newCapacity:1;
       _array = createArray();
       memcpy(_array, oldArray, _size*sizeof(_array[0]));
-      delete[] oldArray;
+      Allocator::deallocateAligned(oldArray);
       if (_size > _capacity)
         _size = _capacity;
     }
@@ -163,7 +164,7 @@ namespace alize
         T** oldArray = _array;
         _array = createArray();
         memcpy(_array, oldArray, _size*sizeof(_array[0]));
-        delete[] oldArray;
+        Allocator::deallocateAligned(oldArray);
       }
       _array[_size] = &o;
       _size++;
@@ -322,7 +323,8 @@ namespace alize
     T** createArray()
     {
       assert(_capacity != 0);
-      T** p = new (std::nothrow) T*[_capacity];
+      T** p = static_cast<T**>(
+                Allocator::allocateAligned(_capacity*sizeof(T*)));
       assertMemoryIsAllocated(p, __FILE__, __LINE__);
       return p;
     }
@@ -165,6 +165,10 @@ namespace alize
     void addOwner(const K&, SegAbstract& o);
     void removeOwner(const K&, SegAbstract& o);
     void removeAllOwners(const K&);
+    void detachOwners(const K&);
+    unsigned long getIndex(const K&) const;
+    void setIndex(const K&, unsigned long idx);
+    void invalidateOwnersIndex(const K&) const;
     virtual void getExtremeBoundaries(const K&, unsigned long& b,
                unsigned long& e, bool& isDefined) const = 0;
   protected :
@@ -179,6 +183,7 @@ namespace alize
 
     SegServer*             _pServer;
     RefVector<SegAbstract> _ownersVect;
+    unsigned long          _idx; /*! index inside the server */
     //virtual void assign(const SegAbstract& s);
   };
 
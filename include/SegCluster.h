@@ -67,6 +67,7 @@
 
 #include "SegAbstract.h"
 #include "RefVector.h"
+#include <vector>
 
 namespace alize
 {
@@ -176,7 +177,18 @@ namespace alize
     /// la feature est la dernire du segment ou la premire
     /// METHODE PROVISOIRE. Sera remplac par une mthode
     /// qui accepte directement pour paramtre une feature (Feature&)
-    /// et non plus le n de la feature
+    /// et non plus le n de la feature\n
+    /// The segments are searched through a segment tree over the
+    /// elementary intervals delimited by the segment bounds : each node
+    /// keeps the lowest cluster position of the segments covering its
+    /// whole interval. The tree is built in O(segments*log(segments))
+    /// on the first call and after any change of the cluster or of its
+    /// segments; a call then costs a binary search of the bounds plus a
+    /// walk from a leaf to the root, O(log(segments)) whatever the
+    /// segment overlaps.
+    /// If several segments contain the feature, the segment found by the
+    /// previous call is kept if it contains the feature; otherwise the
+    /// first one in the cluster is used.
     /// @param n feature number
     /// @param lc a variable to store the label code
     /// @param isFirst a boolean to indicate that the feature is or is not
@@ -235,6 +247,9 @@ namespace alize
                   const String& sn = "");
     virtual void getExtremeBoundaries(const K&, unsigned long& b,
                  unsigned long& e, bool& isDefined) const;
+    void invalidateIndex(const K&);
+    void detachSegs(const K&);
+    void detachAll(const K&);
 
   private :
 
@@ -246,11 +261,28 @@ namespace alize
 
     // for functions getFeatureLabelCode(...)
     mutable Seg*           _pCurrentSeg;
-	  mutable Seg*           _pStartSeg;
     mutable unsigned long  _b;
     mutable unsigned long  _e;
     mutable unsigned long  _lc;
 
+    // index of the segments for getFeatureLabelCode(...) : the segments
+    // of the hierarchy in the order of the cluster, and a segment tree
+    // over the elementary intervals between their boundaries. Each node
+    // holds the smallest position of the segments covering it entirely
+    struct IndexEntry
+    {
+      unsigned long b;
+      unsigned long e;
+      Seg*          pSeg;
+    };
+    mutable std::vector<IndexEntry>    _index;
+    mutable std::vector<unsigned long> _indexBounds; // sorted, unique
+    mutable std::vector<unsigned long> _indexTree;
+    mutable bool           _indexIsValid;
+
+    void collectSegs(std::vector<IndexEntry>&) const;
+    void buildIndex() const;
+
     explicit SegCluster(SegServer& ss, unsigned long lc = 0,
                 const String& s= "", const String& sn = "");
     SegCluster(const SegCluster&); /* not implemented */
@@ -69,6 +69,8 @@
 #include "alizeString.h"
 using alize::String; // before #include <map>
 #include <map>
+#include <vector>
+#include <climits>
 #include "RefVector.h"
 #include "Seg.h"
 #include "SegCluster.h"
@@ -139,11 +141,13 @@ namespace alize
     void remove(SegAbstract& s);
 
     /// Removes (deletes) all segments from the server and from
-    /// all the clusters
+    /// all the clusters. The memory of the segments is kept by the
+    /// server and reused by the next segments
     ///
     void removeAllSegs();
 
-    /// Removes (deletes) all clusters from the server
+    /// Removes (deletes) all clusters from the server. The memory of
+    /// the clusters is kept by the server and reused by the next clusters
     ///
     void removeAllClusters();
 
@@ -234,18 +238,55 @@ namespace alize
 
     // internal usage
     void deleteDeletableSeg(const K&);
+    void* allocateSeg(const K&);
+    void* allocateCluster(const K&);
 
   private :
 
+    /// Memory blocks used to store objects of the same size (segments
+    /// or clusters). A released location is reused by the next
+    /// allocation; reset() makes all the locations free at once.
+    ///
+    class Pool : public Object
+    {
+    public :
+      explicit Pool(unsigned long objectSize);
+      virtual ~Pool();
+      void* allocate();
+      void release(void* p);
+      void reset();
+      virtual String getClassName() const;
+    private :
+      unsigned long      _objectSize;
+      std::vector<char*> _blocks;
+      std::vector<void*> _free;
+      unsigned long      _block; // index of the current block
+      unsigned long      _used;  // count of locations used in this block
+      Pool(const Pool&); /*! not implemented */
+      const Pool& operator=(const Pool&); /*! not implemented */
+    };
+
     String          _serverName;
-    RefVector<Seg> _segVect;
-    RefVector<SegCluster> _clusterVect;
+    // A removed segment or cluster leaves a NULL location which is
+    // removed by compactSegs()/compactClusters() before the next access
+    // by index behind it. Each object knows its index
+    // (SegAbstract::getIndex()).
+    mutable std::vector<Seg*>        _segVect;
+    mutable std::vector<SegCluster*> _clusterVect;
+    mutable unsigned long _removedSegCount;
+    mutable unsigned long _removedClusterCount;
+    mutable unsigned long _firstRemovedSeg; // index of the first NULL
+    mutable unsigned long _firstRemovedCluster;
+    Pool            _segPool;
+    Pool            _clusterPool;
     unsigned long   _nextClusterId;
     typedef std::map<unsigned long, unsigned long>::const_iterator it_t;
-    std::map<unsigned long, unsigned long> _map;
+    mutable std::map<unsigned long, unsigned long> _map;
     SegAbstract& matchingSegAbstract(const SegAbstract&) const;
     void assertServerOwns(const SegAbstract& s) const;
     void assign(const SegServer& ss);
+    void compactSegs(unsigned long idx = ULONG_MAX) const;
+    void compactClusters(unsigned long idx = ULONG_MAX) const;
 
     bool operator==(const SegServer& c) const;/*! not implemented */
     bool operator!=(const SegServer& c) const;/*! not implemented */
@@ -70,6 +70,7 @@
 #include "LKVector.h"
 #include "ViterbiAccum.h"
 #include "MixtureStat.h"
+#include "TopDistribsCache.h"
 
 #if defined(__GNUC__)
 #define DEPRECATED(func) func __attribute__ ((deprecated))
@@ -96,6 +97,11 @@ namespace alize
 
   /// This class is used to compute all the statistics needed for models
   /// training and adapting algorithms as well as for decoding algorithms.
+  /// A StatServer holds all the working data of the likelihood
+  /// computations (top distributions, likelihoods of the distributions,
+  /// mixture statistics). It is not reentrant but several StatServer
+  /// objects, one by thread, can share the same read-only MixtureServer
+  /// and Config (see MixtureServer).
   ///
   /// @author Frederic Wils  frederic.wils@lia.univ-avignon.fr
   /// @version 1.0
@@ -152,7 +158,10 @@ namespace alize
     void computeAllDistribLK(const Feature& f);
 
     /// Returns the best distributions index vector defined after calling
-    /// computeAndAccumulateLLK(...)
+    /// computeAndAccumulateLLK(...) with DETERMINE_TOP_DISTRIBS.
+    /// Only the first topDistribsCount entries (the top distributions)
+    /// are sorted by descending likelihood : the vector is not fully
+    /// sorted and the order of the other entries is undefined.
     /// @return the best distributions index vector
     /// 
     const LKVector& getTopDistribIndexVector() const;
@@ -166,6 +175,22 @@ namespace alize
                                   real_t sumNonTopDistribWeights,
                                   real_t sumNonTopDistribLK);
 
+    /// Appends the current top distributions (determined by the last
+    /// call to computeLLK(...) with DETERMINE_TOP_DISTRIBS) to a cache
+    /// @param c the cache
+    ///
+    void saveTopDistribs(TopDistribsCache& c) const;
+
+    /// Sets the current top distributions from a cache. The next calls
+    /// to computeLLK(...) with USE_TOP_DISTRIBS use them.
+    /// @param c the cache
+    /// @param frameIdx index of the frame in the cache
+    /// @exception Exception if the cache does not hold exactly
+    ///        topDistribsCount top distributions per frame (the non-top
+    ///        sums stored in the cache depend on this count)
+    ///
+    void loadTopDistribs(const TopDistribsCache& c, unsigned long frameIdx);
+
     /// ***** DEPRECATED *****<br>
     /// Returns the count of accumulated features for occupation
     /// @param m the mixture
@@ -0,0 +1,170 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_TopDistribsCache_h)
+#define ALIZE_TopDistribsCache_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+#include "ULongVector.h"
+#include "RealVector.h"
+
+namespace alize
+{
+  class LKVector;
+  class Config;
+
+  /// This class stores, for each frame of a segment, the indexes of the
+  /// top distributions and the values sumNonTopDistribWeights and
+  /// sumNonTopDistribLK computed by StatServer::computeLLK(...) with
+  /// DETERMINE_TOP_DISTRIBS. The cache can be saved in a file and loaded
+  /// later so that the segment can be scored against other models
+  /// without computing the world model again.\n
+  /// File format (byte order of the writer, swapped at loading if needed) :\n
+  /// - 8 chars "TOPDIST1"\n
+  /// - 4 bytes byte order check word 0x01020304\n
+  /// - 4 bytes unsigned integers : distribution count, top distribution
+  ///   count, frame count, size of an index (2 or 4 bytes)\n
+  /// - the indexes of all the frames\n
+  /// - the sumNonTopDistribWeights values (doubles)\n
+  /// - the sumNonTopDistribLK values (doubles)
+  ///
+  /// @version 1.0
+  /// @date 2010
+
+  class ALIZE_API TopDistribsCache : public Object
+  {
+
+  public :
+
+    explicit TopDistribsCache();
+    static TopDistribsCache& create();
+    virtual ~TopDistribsCache();
+
+    /// Appends the top distributions of a frame
+    /// @param v the vector sorted by StatServer::computeLLK(...) with
+    ///        DETERMINE_TOP_DISTRIBS
+    /// @exception Exception if the distribution count or the top
+    ///        distribution count is not the same as the previous frames
+    ///
+    void addFrame(const LKVector& v);
+
+    /// Copies the top distributions of a frame to a vector.
+    /// The size of the vector is set to the distribution count and
+    /// only the first top distribution count elements are defined.
+    /// @param idx index of the frame (order of the addFrame calls)
+    /// @param v the vector to set
+    /// @exception IndexOutOfBoundsException
+    ///
+    void getFrame(unsigned long idx, LKVector& v) const;
+
+    unsigned long getFrameCount() const;
+    unsigned long getDistribCount() const;
+    unsigned long getTopDistribsCount() const;
+
+    /// Removes all the frames
+    ///
+    void clear();
+
+    /// Loads the cache from a file
+    /// @param f the name of the file. The parameters
+    ///    "topDistribsCacheFilesPath" and "topDistribsCacheFileExtension"
+    ///    of the configuration are used if they are defined and if the
+    ///    name does not begin with "/" or "./"
+    /// @param c the configuration to use
+    /// @exception IOException if an I/O error occurs
+    /// @exception InvalidDataException if the file is not a cache file
+    ///
+    void load(const FileName& f, const Config& c);
+
+    /// Saves the cache in a file
+    /// @param f the name of the file (see load(...))
+    /// @param c the configuration to use
+    /// @exception IOException if an I/O error occurs
+    ///
+    void save(const FileName& f, const Config& c) const;
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private :
+
+    unsigned long _distribCount;
+    unsigned long _topDistribsCount;
+    unsigned long _frameCount;
+    ULongVector   _indexVect; // _frameCount*_topDistribsCount indexes
+    DoubleVector  _sumNonTopDistribWeightsVect;
+    DoubleVector  _sumNonTopDistribLKVect;
+
+    static FileName getFullFileName(const FileName&, const Config&);
+
+    bool operator==(const TopDistribsCache&) const; /*!Not implemented*/
+    bool operator!=(const TopDistribsCache&) const; /*!Not implemented*/
+    const TopDistribsCache& operator=(
+                const TopDistribsCache&); /*!Not implemented*/
+    TopDistribsCache(const TopDistribsCache&); /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_TopDistribsCache_h)
@@ -66,6 +66,7 @@
 #endif
 
 #include "Object.h"
+#include "Allocator.h"
 
 namespace alize
 {
@@ -92,6 +93,14 @@ namespace alize
     ///    overtake the capacity
     ///
     explicit ULongVector(unsigned long capacity = 0, unsigned long size = 0);
+
+    /// Same as ULongVector(capacity, size) but the memory comes from an
+    /// allocator. The allocator must live longer than the vector.
+    ///
+    ULongVector(unsigned long capacity, unsigned long size, Allocator& a);
+
+    /// The copy uses the aligned functions of Allocator
+    ///
     const ULongVector& operator=(const ULongVector&);
     bool operator==(const ULongVector&) const;
     bool operator!=(const ULongVector&) const;
@@ -158,11 +167,13 @@ namespace alize
 	void load(const FileName& f);
   private:
 
+    Allocator*    _pAllocator; /*!< NULL for the aligned functions */
     unsigned long _size;
     unsigned long _capacity;
     _type*        _array;
 
     _type* createArray() const;
+    void deallocateArray(_type*) const;
     static int compare(const void*, const void*);
   };
 
@@ -69,6 +69,9 @@
 #include "XLine.h"
 #include "RefVector.h"
 #include "Exception.h"
+#include "alizeString.h"
+using alize::String; // before #include <map>
+#include <map>
 
 namespace alize
 {
@@ -177,7 +180,14 @@ namespace alize
     ///
     unsigned long getLineCount() const;
 
-    /// Finds a line. This line becomes the current line
+    /// Finds a line. This line becomes the current line.\n
+    /// The first search on a given element index builds a key index
+    /// for this position; it is completed with the lines added since
+    /// the last search, so repeated successful searches cost
+    /// O(log(lines)). A key which is not in the index, or whose line
+    /// has been modified in place, makes the index be rebuilt once (lines
+    /// completed or edited after the last search are seen), so a failed
+    /// search costs O(lines) like a linear scan.
     /// @param key the key
     /// @param idx the index of the key
     /// @return a pointer to the line if it exists; NULL otherwise
@@ -198,9 +208,22 @@ namespace alize
 
   private :
 
+    /// key -> index of the first line having this key
+    struct KeyIndex
+    {
+      std::map<String, unsigned long> map;
+      unsigned long lineCount; // number of lines already indexed
+      KeyIndex() :lineCount(0) {}
+    };
+
     RefVector<XLine>      _vector;
     mutable unsigned long _current;
     mutable XLine         _line;
+    /// element index -> key index
+    mutable std::map<unsigned long, KeyIndex> _index;
+
+    long findLineIndex(const String& key, unsigned long idx,
+                       bool rebuilt = false) const;
   };
 
 } // end namespace alize
@@ -55,7 +55,9 @@
 #if !defined(ALIZE_alize_h)
 #define ALIZE_alize_h
 
+#include "Allocator.h"
 #include "AutoDestructor.h"
+#include "ByteSwap.h"
 #include "Exception.h"
 #include "alizeString.h"
 #include "RealVector.h"
@@ -85,25 +87,33 @@
 #include "MixtureGF.h"
 #include "FeatureFlags.h"
 #include "Feature.h"
+#include "FeatureBlock.h"
+#include "FeatureComputer.h"
 
 #include "LabelServer.h"
 #include "MixtureServer.h"
 #include "FeatureServer.h"
 #include "MixtureStat.h"
+#include "Numa.h"
 #include "MixtureGDStat.h"
 #include "MixtureGFStat.h"
 #include "FrameAcc.h"
 #include "FrameAccGD.h"
 #include "FrameAccGF.h"
 #include "StatServer.h"
+#include "TopDistribsCache.h"
 
 #include "FeatureMultipleFileReader.h"
 #include "FeatureFileReaderRaw.h"
+#include "FeatureFileReaderAudio.h"
 #include "FeatureFileReaderSPro3.h"
 #include "FeatureFileReaderSPro4.h"
 #include "FeatureFileReaderHTK.h"
 #include "FeatureFileReader.h"
 #include "FeatureInputStreamModifier.h"
+#include "FeatureInputStreamDelta.h"
+#include "FeatureInputStreamNormalizer.h"
+#include "FeatureInputStreamSelector.h"
 #include "MixtureFileReaderAmiral.h"
 #include "MixtureFileReaderRaw.h"
 #include "MixtureFileReaderXml.h"
@@ -117,6 +127,7 @@
 #include "ConfigFileReaderRaw.h"
 #include "ConfigFileReaderXml.h"
 #include "ConfigFileWriter.h"
+#include "Counters.h"
 #include "SegServerFileWriter.h"
 #include "XListFileReader.h"
 #include "LabelFileReader.h"
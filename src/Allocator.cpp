@@ -0,0 +1,164 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_Allocator_cpp)
+#define ALIZE_Allocator_cpp
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+#include <cstdlib>
+#include "Allocator.h"
+#include "alizeString.h"
+
+using namespace alize;
+
+//-------------------------------------------------------------------------
+Allocator::Allocator() :Object() {}
+//-------------------------------------------------------------------------
+void* Allocator::allocateAligned(unsigned long size)
+{
+  if (size == 0)
+    size = 1;
+#if defined(_WIN32)
+  return _aligned_malloc(size, ALIGNMENT);
+#else
+  void* p;
+  if (posix_memalign(&p, ALIGNMENT, size) != 0)
+    return NULL;
+  return p;
+#endif
+}
+//-------------------------------------------------------------------------
+void Allocator::deallocateAligned(void* p)
+{
+#if defined(_WIN32)
+  _aligned_free(p);
+#else
+  free(p);
+#endif
+}
+//-------------------------------------------------------------------------
+//-------------------------------------------------------------------------
+ArenaAllocator::ArenaAllocator(unsigned long chunkSize)
+:Allocator(), _chunkSize(chunkSize), _pFirst(NULL), _pCurrent(NULL),
+ _used(0) {}
+//-------------------------------------------------------------------------
+void* ArenaAllocator::allocate(unsigned long size)
+{
+  // the header of a chunk takes ALIGNMENT bytes to keep the blocks aligned
+  size = (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+  if (size == 0)
+    size = ALIGNMENT;
+  // after a reset, skips the chunks too small for this block
+  while (_pCurrent != NULL && _used + size > _pCurrent->size)
+  {
+    _pCurrent = _pCurrent->next;
+    _used = 0;
+  }
+  if (_pCurrent == NULL)
+  {
+    const unsigned long s = size > _chunkSize ? size : _chunkSize;
+    Chunk* c = static_cast<Chunk*>(allocateAligned(ALIGNMENT + s));
+    if (c == NULL)
+      return NULL;
+    c->next = NULL;
+    c->size = s;
+    if (_pFirst == NULL)
+      _pFirst = c;
+    else
+    {
+      Chunk* last = _pFirst;
+      while (last->next != NULL)
+        last = last->next;
+      last->next = c;
+    }
+    _pCurrent = c;
+    _used = 0;
+  }
+  void* p = reinterpret_cast<char*>(_pCurrent) + ALIGNMENT + _used;
+  _used += size;
+  return p;
+}
+//-------------------------------------------------------------------------
+void ArenaAllocator::deallocate(void*) {}
+//-------------------------------------------------------------------------
+void ArenaAllocator::reset()
+{
+  _pCurrent = _pFirst;
+  _used = 0;
+}
+//-------------------------------------------------------------------------
+unsigned long ArenaAllocator::getChunksSize() const
+{
+  unsigned long s = 0;
+  for (Chunk* c=_pFirst; c!=NULL; c=c->next)
+    s += c->size;
+  return s;
+}
+//-------------------------------------------------------------------------
+String ArenaAllocator::getClassName() const { return "ArenaAllocator"; }
+//-------------------------------------------------------------------------
+ArenaAllocator::~ArenaAllocator()
+{
+  while (_pFirst != NULL)
+  {
+    Chunk* c = _pFirst;
+    _pFirst = c->next;
+    deallocateAligned(c);
+  }
+}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_Allocator_cpp)
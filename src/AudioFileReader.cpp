@@ -55,20 +55,27 @@
 #if !defined(ALIZE_AudioFileReader_cpp)
 #define ALIZE_AudioFileReader_cpp
 #include <new>
+#include <climits>
+#include <cstring>
 #include "AudioFileReader.h"
 #include "AudioFrame.h"
 #include "alizeString.h"
 #include "Config.h"
 #include "FileReader.h"
+#include "ByteSwap.h"
+#include "Exception.h"
 
 using namespace alize;
 typedef AudioFileReader R;
 
+static const unsigned long CHUNK_FRAME_COUNT = 4096; // frames read at once
+
 //-------------------------------------------------------------------------
 R::AudioFileReader(const FileName& f, const Config& c, BigEndian be)
 :AudioInputStream(getChannel(c)), _pReader(&FileReader::create(f, getPath(f, c),
  getExt(f, c), getBigEndian(c, be))), _frameIndex(0), _paramDefined(false),
- _seekWanted(true), _seekWantedIdx(0)
+ _seekWanted(true), _seekWantedIdx(0), _samplesIndex(0),
+ _samplesChannel(ULONG_MAX), _fileFrameIndex(ULONG_MAX), _pChunk(NULL)
 {
   // only SPHERE files (other formats later...)
   // on part du principe que les .sph on un codage ulaw
@@ -100,6 +107,7 @@ void R::close()
 {
   if (_pReader != NULL)
     _pReader->close();
+  _fileFrameIndex = ULONG_MAX;
 }
 //-------------------------------------------------------------------------
 unsigned long R::getChannel(const Config& c) const
@@ -125,80 +133,91 @@ bool R::getBigEndian(const Config& c, BigEndian b) const // protected
 //-------------------------------------------------------------------------
 bool R::readFrame(AudioFrame& f)
 {
+  if (!loadSamples())
+    return false;
+  f.setData((long)_samples[_frameIndex-_samplesIndex]);
+  f.setValidity(true);
+  _frameIndex++;
+  return true;
+}
+//-------------------------------------------------------------------------
+unsigned long R::readFrames(FloatVector& v, unsigned long maxCount)
+{
+  v.setSize(maxCount);
+  unsigned long n = 0;
+  while (n < maxCount && loadSamples())
+  {
+    unsigned long m = _samplesIndex+_samples.size()-_frameIndex;
+    if (m > maxCount-n)
+      m = maxCount-n;
+    memcpy(v.getArray()+n, _samples.getArray()+(_frameIndex-_samplesIndex),
+           m*sizeof(float));
+    n += m;
+    _frameIndex += m;
+  }
+  v.setSize(n);
+  return n;
+}
+//-------------------------------------------------------------------------
+bool R::loadSamples() // private
+{ // makes the frame #_frameIndex available in _samples
   if (_seekWanted)
   {
     _seekWanted = false;
     _frameIndex = _seekWantedIdx;
-    if (_frameIndex >= getFrameCount())
-      return false;
-    unsigned long n = getSampleBytes()*getChannelCount();
-    _pReader->seek(getHeaderLength()+n*_frameIndex);
   }
-  // si on depasse la fin du fichier
-  unsigned long i, frameCount = getFrameCount();
   // the call to getFrameCount() defines _sampleBytes & other stuff
+  const unsigned long frameCount = getFrameCount();
   if (_frameIndex >= frameCount)
     return false;
-  if (_selectedChannel > _channelCount)
+  if (_selectedChannel >= _channelCount)
     throw Exception("Unavailable selected channel #"
           + String::valueOf(_selectedChannel), __FILE__, __LINE__);
+  if (_samplesChannel == _selectedChannel && _frameIndex >= _samplesIndex
+      && _frameIndex < _samplesIndex+_samples.size())
+    return true;
+  if (_sampleBytes != 1 && _sampleBytes != 2)
+    throw Exception("Unimplemented code (TODO)", __FILE__, __LINE__);
+  // reads a chunk of interleaved frames
+  const unsigned long frameBytes = _sampleBytes*_channelCount;
+  if (_pChunk == NULL)
+  {
+    _pChunk = new (std::nothrow) short[(CHUNK_FRAME_COUNT*frameBytes+1)/2];
+    assertMemoryIsAllocated(_pChunk, __FILE__, __LINE__);
+  }
+  if (_fileFrameIndex != _frameIndex)
+    _pReader->seek(getHeaderLength()+frameBytes*_frameIndex);
+  unsigned long n = frameCount-_frameIndex;
+  if (n > CHUNK_FRAME_COUNT)
+    n = CHUNK_FRAME_COUNT;
+  const unsigned long byteCount = _pReader->readSomeBytes(_pChunk,
+                                                          n*frameBytes);
+  n = byteCount/frameBytes;
+  _fileFrameIndex = (byteCount%frameBytes == 0) ? _frameIndex+n : ULONG_MAX;
+  if (n == 0)
+    throw EOFException("", __FILE__, __LINE__, _pReader->getFullFileName());
+  // keeps the selected channel
+  _samples.setSize(n);
+  float* out = _samples.getArray();
+  const unsigned long channelCount = _channelCount;
+  unsigned long i;
   if (_sampleBytes == 2) // 16 bits
   {
-    if (_channelCount == 1)
-      f.setData(_pReader->readInt2());
-    else if (_channelCount == 2)
-    {
-      if (_selectedChannel == 0)
-      {
-        f.setData(_pReader->readInt2());
-        _pReader->readInt2();
-      }
-      else
-      {
-        _pReader->readInt2();
-        f.setData(_pReader->readInt2());
-      }
-    }
-    else // multi-channels
-    {
-      for (i=0; i<_selectedChannel; i++)
-        _pReader->readInt2();
-      f.setData(_pReader->readInt2());
-      for (i++; i<_channelCount; i++)
-        _pReader->readInt2();
-    }
+    const short* in = _pChunk+_selectedChannel;
+    if (_pReader->swap())
+      ByteSwap::swap2(_pChunk, n*channelCount);
+    for (i=0; i<n; i++)
+      out[i] = (float)in[i*channelCount];
   }
-  else if (_sampleBytes == 1) // 8 bits
+  else // 8 bits
   {
-    if (_channelCount == 1)
-      f.setData(_pReader->readChar());
-    else if (_channelCount == 2)
-    {
-      if (_selectedChannel == 0)
-      {
-        f.setData(_pReader->readChar());
-        _pReader->readChar();
-      }
-      else
-      {
-        _pReader->readChar();
-        f.setData(_pReader->readChar());
-      }
-    }
-    else // multi-channels
-    {
-      for (i=0; i<_selectedChannel; i++)
-        _pReader->readChar();
-      f.setData(_pReader->readChar());
-      for (i++; i<_channelCount; i++)
-        _pReader->readChar();
-    }
+    const char* in = (const char*)_pChunk+_selectedChannel;
+    for (i=0; i<n; i++)
+      out[i] = (float)in[i*channelCount];
   }
-  else
-    throw Exception("Unimplemented code (TODO)", __FILE__, __LINE__);
-  f.setValidity(true);
-  _frameIndex++;
-  return true; // invalid frame
+  _samplesIndex = _frameIndex;
+  _samplesChannel = _selectedChannel;
+  return true;
 }
 //-------------------------------------------------------------------------
 void R::seekFrame(unsigned long n) // n = next frame to read
@@ -319,6 +338,8 @@ R::~AudioFileReader()
 {
   assert(_pReader != NULL);
   delete _pReader;
+  if (_pChunk != NULL)
+    delete [] _pChunk;
 }
 //-------------------------------------------------------------------------
 
@@ -72,6 +72,17 @@ void S::setSelectedChannel(unsigned long s) { _selectedChannel = s; }
 //-------------------------------------------------------------------------
 unsigned long S::getSelectedChannel() const { return _selectedChannel; }
 //-------------------------------------------------------------------------
+unsigned long S::readFrames(FloatVector& v, unsigned long maxCount)
+{
+  AudioFrame f;
+  v.setSize(maxCount);
+  unsigned long n = 0;
+  for (; n<maxCount && readFrame(f); n++)
+    v[n] = (float)f.getData();
+  v.setSize(n);
+  return n;
+}
+//-------------------------------------------------------------------------
 S::~AudioInputStream() {}
 //-------------------------------------------------------------------------
 
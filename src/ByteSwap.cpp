@@ -0,0 +1,261 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_ByteSwap_cpp)
+#define ALIZE_ByteSwap_cpp
+
+#include <cstring>
+#include "ByteSwap.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) \
+    && (defined(__x86_64__) || defined(__i386__))
+#define ALIZE_BYTESWAP_X86
+#include <immintrin.h>
+#define ALIZE_TARGET(t) __attribute__((target(t)))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define ALIZE_BYTESWAP_X86
+#include <intrin.h>
+#include <immintrin.h>
+#define ALIZE_TARGET(t)
+#endif
+
+using namespace alize;
+
+enum Kernel
+{
+  KERNEL_GENERIC,
+  KERNEL_SSSE3,
+  KERNEL_AVX2
+};
+
+//-------------------------------------------------------------------------
+// portable kernels. The values are loaded as integers so the compiler
+// can vectorize the loops
+//-------------------------------------------------------------------------
+static void genericSwap2(char* p, unsigned long n)
+{
+  for (unsigned long i=0; i<n; i++, p+=2)
+  {
+    unsigned short x;
+    memcpy(&x, p, 2);
+    x = (unsigned short)((x >> 8) | (x << 8));
+    memcpy(p, &x, 2);
+  }
+}
+//-------------------------------------------------------------------------
+static unsigned int swapUInt4(unsigned int x)
+{ return (x >> 24) | ((x >> 8) & 0xff00) | ((x << 8) & 0xff0000) | (x << 24); }
+//-------------------------------------------------------------------------
+static void genericSwap4(char* p, unsigned long n)
+{
+  for (unsigned long i=0; i<n; i++, p+=4)
+  {
+    unsigned int x;
+    memcpy(&x, p, 4);
+    x = swapUInt4(x);
+    memcpy(p, &x, 4);
+  }
+}
+//-------------------------------------------------------------------------
+static void genericSwap8(char* p, unsigned long n)
+{
+  for (unsigned long i=0; i<n; i++, p+=8)
+  {
+    unsigned int x, y;
+    memcpy(&x, p, 4);
+    memcpy(&y, p+4, 4);
+    x = swapUInt4(x);
+    y = swapUInt4(y);
+    memcpy(p, &y, 4);
+    memcpy(p+4, &x, 4);
+  }
+}
+//-------------------------------------------------------------------------
+static void genericSwap(char* p, unsigned long n, unsigned long size)
+{
+  if (size == 2)
+    genericSwap2(p, n);
+  else if (size == 4)
+    genericSwap4(p, n);
+  else
+    genericSwap8(p, n);
+}
+#if defined(ALIZE_BYTESWAP_X86)
+//-------------------------------------------------------------------------
+// shuffle kernels. A mask gives the source byte of each byte of a
+// 128 bits lane (repeated for the 2 lanes of AVX2)
+//-------------------------------------------------------------------------
+static const char MASK2[32] = {1,0,3,2,5,4,7,6,9,8,11,10,13,12,15,14,
+                               1,0,3,2,5,4,7,6,9,8,11,10,13,12,15,14};
+static const char MASK4[32] = {3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12,
+                               3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12};
+static const char MASK8[32] = {7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8,
+                               7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8};
+//-------------------------------------------------------------------------
+static const char* getMask(unsigned long size)
+{ return size == 2 ? MASK2 : (size == 4 ? MASK4 : MASK8); }
+//-------------------------------------------------------------------------
+ALIZE_TARGET("ssse3")
+static void ssse3Swap(char* p, unsigned long n, unsigned long size)
+{
+  const __m128i mask = _mm_loadu_si128((const __m128i*)getMask(size));
+  const unsigned long length = n*size;
+  unsigned long i = 0;
+  for (; i+16<=length; i+=16)
+  {
+    __m128i v = _mm_loadu_si128((const __m128i*)(p+i));
+    _mm_storeu_si128((__m128i*)(p+i), _mm_shuffle_epi8(v, mask));
+  }
+  genericSwap(p+i, (length-i)/size, size);
+}
+//-------------------------------------------------------------------------
+ALIZE_TARGET("avx2")
+static void avx2Swap(char* p, unsigned long n, unsigned long size)
+{
+  const __m256i mask = _mm256_loadu_si256((const __m256i*)getMask(size));
+  const unsigned long length = n*size;
+  unsigned long i = 0;
+  for (; i+64<=length; i+=64)
+  {
+    __m256i v0 = _mm256_loadu_si256((const __m256i*)(p+i));
+    __m256i v1 = _mm256_loadu_si256((const __m256i*)(p+i+32));
+    _mm256_storeu_si256((__m256i*)(p+i), _mm256_shuffle_epi8(v0, mask));
+    _mm256_storeu_si256((__m256i*)(p+i+32), _mm256_shuffle_epi8(v1, mask));
+  }
+  for (; i+32<=length; i+=32)
+  {
+    __m256i v = _mm256_loadu_si256((const __m256i*)(p+i));
+    _mm256_storeu_si256((__m256i*)(p+i), _mm256_shuffle_epi8(v, mask));
+  }
+  genericSwap(p+i, (length-i)/size, size);
+}
+#endif
+//-------------------------------------------------------------------------
+static Kernel detectKernel()
+{
+#if defined(ALIZE_BYTESWAP_X86) && !defined(_MSC_VER)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2"))
+    return KERNEL_AVX2;
+  if (__builtin_cpu_supports("ssse3"))
+    return KERNEL_SSSE3;
+#elif defined(ALIZE_BYTESWAP_X86)
+  int r[4];
+  __cpuid(r, 0);
+  const int maxLeaf = r[0];
+  __cpuid(r, 1);
+  const bool ssse3 = (r[2] & (1 << 9)) != 0;
+  const bool osAvx = (r[2] & (1 << 27)) != 0 && (r[2] & (1 << 28)) != 0
+                     && (_xgetbv(0) & 6) == 6; // OS saves the ymm registers
+  if (maxLeaf >= 7 && osAvx)
+  {
+    __cpuidex(r, 7, 0);
+    if ((r[1] & (1 << 5)) != 0)
+      return KERNEL_AVX2;
+  }
+  if (ssse3)
+    return KERNEL_SSSE3;
+#endif
+  return KERNEL_GENERIC;
+}
+//-------------------------------------------------------------------------
+static Kernel getKernel()
+{
+  static const Kernel kernel = detectKernel();
+  return kernel;
+}
+//-------------------------------------------------------------------------
+static void swapBytes(void* array, unsigned long n, unsigned long size)
+{
+  char* p = (char*)array;
+#if defined(ALIZE_BYTESWAP_X86)
+  switch (getKernel())
+  {
+    case KERNEL_AVX2:
+      avx2Swap(p, n, size);
+      return;
+    case KERNEL_SSSE3:
+      ssse3Swap(p, n, size);
+      return;
+    default:
+      break;
+  }
+#endif
+  genericSwap(p, n, size);
+}
+//-------------------------------------------------------------------------
+void ByteSwap::swap2(void* array, unsigned long n)
+{ swapBytes(array, n, 2); }
+//-------------------------------------------------------------------------
+void ByteSwap::swap4(void* array, unsigned long n)
+{ swapBytes(array, n, 4); }
+//-------------------------------------------------------------------------
+void ByteSwap::swap8(void* array, unsigned long n)
+{ swapBytes(array, n, 8); }
+//-------------------------------------------------------------------------
+const char* ByteSwap::getKernelName()
+{
+  switch (getKernel())
+  {
+    case KERNEL_AVX2:
+      return "AVX2";
+    case KERNEL_SSSE3:
+      return "SSSE3";
+    default:
+      return "generic";
+  }
+}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_ByteSwap_cpp)
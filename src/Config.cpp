@@ -92,6 +92,26 @@ void Config::assign(const Config& c) // private
   ASSIGN(_param_topDistribsCount);
   ASSIGN(_param_featureServerBufferSize);
   ASSIGN(_param_featureServerMask);
+  ASSIGN(_param_featureServerSelectionCoef);
+  ASSIGN(_param_featureServerSelectionThreshold);
+  ASSIGN(_param_featureServerNormalization);
+  ASSIGN(_param_featureServerNormalizationWindow);
+  ASSIGN(_param_featureServerDeltaWindow);
+  ASSIGN(_param_featureServerDeltaDelta);
+  ASSIGN(_param_featureComputerFrameLength);
+  ASSIGN(_param_featureComputerFrameShift);
+  ASSIGN(_param_featureComputerPreEmphasis);
+  ASSIGN(_param_featureComputerFilterCount);
+  ASSIGN(_param_featureComputerCepstralCount);
+  ASSIGN(_param_featureComputerEnergy);
+  ASSIGN(_param_featureComputerMinFrequency);
+  ASSIGN(_param_featureComputerMaxFrequency);
+  ASSIGN(_param_saveFeatureFileBigEndian);
+  ASSIGN(_param_topDistribsCacheFilesPath);
+  ASSIGN(_param_topDistribsCacheFileExtension);
+  ASSIGN(_param_mixtureServerCacheMemAlloc);
+  ASSIGN(_param_occPruningThreshold);
+  ASSIGN(_param_occPruningTopDistribsCount);
   ASSIGN(_param_featureFlags);
   ASSIGN(_param_mixtureDistribCount);
   ASSIGN(_param_loadFeatureFileFormat);
@@ -135,6 +155,26 @@ void Config::assign(const Config& c) // private
   ASSIGN(existsParam_topDistribsCount);
   ASSIGN(existsParam_featureServerBufferSize);
   ASSIGN(existsParam_featureServerMask);
+  ASSIGN(existsParam_featureServerSelectionCoef);
+  ASSIGN(existsParam_featureServerSelectionThreshold);
+  ASSIGN(existsParam_featureServerNormalization);
+  ASSIGN(existsParam_featureServerNormalizationWindow);
+  ASSIGN(existsParam_featureServerDeltaWindow);
+  ASSIGN(existsParam_featureServerDeltaDelta);
+  ASSIGN(existsParam_featureComputerFrameLength);
+  ASSIGN(existsParam_featureComputerFrameShift);
+  ASSIGN(existsParam_featureComputerPreEmphasis);
+  ASSIGN(existsParam_featureComputerFilterCount);
+  ASSIGN(existsParam_featureComputerCepstralCount);
+  ASSIGN(existsParam_featureComputerEnergy);
+  ASSIGN(existsParam_featureComputerMinFrequency);
+  ASSIGN(existsParam_featureComputerMaxFrequency);
+  ASSIGN(existsParam_saveFeatureFileBigEndian);
+  ASSIGN(existsParam_topDistribsCacheFilesPath);
+  ASSIGN(existsParam_topDistribsCacheFileExtension);
+  ASSIGN(existsParam_mixtureServerCacheMemAlloc);
+  ASSIGN(existsParam_occPruningThreshold);
+  ASSIGN(existsParam_occPruningTopDistribsCount);
   ASSIGN(existsParam_loadFeatureFileFormat);
   ASSIGN(existsParam_loadFeatureFileVectSize);
   ASSIGN(existsParam_loadAudioFileChannel);
@@ -209,6 +249,26 @@ void Config::reset()
   existsParam_topDistribsCount = false;
   existsParam_featureServerBufferSize = false;
   existsParam_featureServerMask = false;
+  existsParam_featureServerSelectionCoef = false;
+  existsParam_featureServerSelectionThreshold = false;
+  existsParam_featureServerNormalization = false;
+  existsParam_featureServerNormalizationWindow = false;
+  existsParam_featureServerDeltaWindow = false;
+  existsParam_featureServerDeltaDelta = false;
+  existsParam_featureComputerFrameLength = false;
+  existsParam_featureComputerFrameShift = false;
+  existsParam_featureComputerPreEmphasis = false;
+  existsParam_featureComputerFilterCount = false;
+  existsParam_featureComputerCepstralCount = false;
+  existsParam_featureComputerEnergy = false;
+  existsParam_featureComputerMinFrequency = false;
+  existsParam_featureComputerMaxFrequency = false;
+  existsParam_saveFeatureFileBigEndian = false;
+  existsParam_topDistribsCacheFilesPath = false;
+  existsParam_topDistribsCacheFileExtension = false;
+  existsParam_mixtureServerCacheMemAlloc = false;
+  existsParam_occPruningThreshold = false;
+  existsParam_occPruningTopDistribsCount = false;
   existsParam_featureFlags = false;
   existsParam_mixtureDistribCount = false;
   existsParam_minLLK = false;
@@ -355,6 +415,166 @@ const String& Config::getParam_featureServerMask() const
   return _param_featureServerMask;
 }
 //-------------------------------------------------------------------------
+unsigned long Config::getParam_featureServerSelectionCoef() const
+{
+  if (!existsParam_featureServerSelectionCoef)
+    throw ParamNotFoundInConfigException("featureServerSelectionCoef' in the config",
+                        __FILE__, __LINE__);
+  return _param_featureServerSelectionCoef;
+}
+//-------------------------------------------------------------------------
+real_t Config::getParam_featureServerSelectionThreshold() const
+{
+  if (!existsParam_featureServerSelectionThreshold)
+    throw ParamNotFoundInConfigException("featureServerSelectionThreshold' in the config",
+                        __FILE__, __LINE__);
+  return _param_featureServerSelectionThreshold;
+}
+//-------------------------------------------------------------------------
+const String& Config::getParam_featureServerNormalization() const
+{
+  if (!existsParam_featureServerNormalization)
+    throw ParamNotFoundInConfigException("featureServerNormalization' in the config",
+                        __FILE__, __LINE__);
+  return _param_featureServerNormalization;
+}
+//-------------------------------------------------------------------------
+unsigned long Config::getParam_featureServerNormalizationWindow() const
+{
+  if (!existsParam_featureServerNormalizationWindow)
+    throw ParamNotFoundInConfigException("featureServerNormalizationWindow' in the config",
+                        __FILE__, __LINE__);
+  return _param_featureServerNormalizationWindow;
+}
+//-------------------------------------------------------------------------
+unsigned long Config::getParam_featureServerDeltaWindow() const
+{
+  if (!existsParam_featureServerDeltaWindow)
+    throw ParamNotFoundInConfigException("featureServerDeltaWindow' in the config",
+                        __FILE__, __LINE__);
+  return _param_featureServerDeltaWindow;
+}
+//-------------------------------------------------------------------------
+bool Config::getParam_featureServerDeltaDelta() const
+{
+  if (!existsParam_featureServerDeltaDelta)
+    throw ParamNotFoundInConfigException("featureServerDeltaDelta' in the config",
+                        __FILE__, __LINE__);
+  return _param_featureServerDeltaDelta;
+}
+//-------------------------------------------------------------------------
+real_t Config::getParam_featureComputerFrameLength() const
+{
+  if (!existsParam_featureComputerFrameLength)
+    throw ParamNotFoundInConfigException("featureComputerFrameLength' in the config",
+                        __FILE__, __LINE__);
+  return _param_featureComputerFrameLength;
+}
+//-------------------------------------------------------------------------
+real_t Config::getParam_featureComputerFrameShift() const
+{
+  if (!existsParam_featureComputerFrameShift)
+    throw ParamNotFoundInConfigException("featureComputerFrameShift' in the config",
+                        __FILE__, __LINE__);
+  return _param_featureComputerFrameShift;
+}
+//-------------------------------------------------------------------------
+real_t Config::getParam_featureComputerPreEmphasis() const
+{
+  if (!existsParam_featureComputerPreEmphasis)
+    throw ParamNotFoundInConfigException("featureComputerPreEmphasis' in the config",
+                        __FILE__, __LINE__);
+  return _param_featureComputerPreEmphasis;
+}
+//-------------------------------------------------------------------------
+unsigned long Config::getParam_featureComputerFilterCount() const
+{
+  if (!existsParam_featureComputerFilterCount)
+    throw ParamNotFoundInConfigException("featureComputerFilterCount' in the config",
+                        __FILE__, __LINE__);
+  return _param_featureComputerFilterCount;
+}
+//-------------------------------------------------------------------------
+unsigned long Config::getParam_featureComputerCepstralCount() const
+{
+  if (!existsParam_featureComputerCepstralCount)
+    throw ParamNotFoundInConfigException("featureComputerCepstralCount' in the config",
+                        __FILE__, __LINE__);
+  return _param_featureComputerCepstralCount;
+}
+//-------------------------------------------------------------------------
+bool Config::getParam_featureComputerEnergy() const
+{
+  if (!existsParam_featureComputerEnergy)
+    throw ParamNotFoundInConfigException("featureComputerEnergy' in the config",
+                        __FILE__, __LINE__);
+  return _param_featureComputerEnergy;
+}
+//-------------------------------------------------------------------------
+real_t Config::getParam_featureComputerMinFrequency() const
+{
+  if (!existsParam_featureComputerMinFrequency)
+    throw ParamNotFoundInConfigException("featureComputerMinFrequency' in the config",
+                        __FILE__, __LINE__);
+  return _param_featureComputerMinFrequency;
+}
+//-------------------------------------------------------------------------
+real_t Config::getParam_featureComputerMaxFrequency() const
+{
+  if (!existsParam_featureComputerMaxFrequency)
+    throw ParamNotFoundInConfigException("featureComputerMaxFrequency' in the config",
+                        __FILE__, __LINE__);
+  return _param_featureComputerMaxFrequency;
+}
+//-------------------------------------------------------------------------
+bool Config::getParam_saveFeatureFileBigEndian() const
+{
+  if (!existsParam_saveFeatureFileBigEndian)
+    throw ParamNotFoundInConfigException("saveFeatureFileBigEndian' in the config",
+                        __FILE__, __LINE__);
+  return _param_saveFeatureFileBigEndian;
+}
+//-------------------------------------------------------------------------
+const String& Config::getParam_topDistribsCacheFilesPath() const
+{
+  if (!existsParam_topDistribsCacheFilesPath)
+    throw ParamNotFoundInConfigException("topDistribsCacheFilesPath' in the config",
+                        __FILE__, __LINE__);
+  return _param_topDistribsCacheFilesPath;
+}
+//-------------------------------------------------------------------------
+const String& Config::getParam_topDistribsCacheFileExtension() const
+{
+  if (!existsParam_topDistribsCacheFileExtension)
+    throw ParamNotFoundInConfigException("topDistribsCacheFileExtension' in the config",
+                        __FILE__, __LINE__);
+  return _param_topDistribsCacheFileExtension;
+}
+//-------------------------------------------------------------------------
+unsigned long Config::getParam_mixtureServerCacheMemAlloc() const
+{
+  if (!existsParam_mixtureServerCacheMemAlloc)
+    throw ParamNotFoundInConfigException("mixtureServerCacheMemAlloc' in the config",
+                        __FILE__, __LINE__);
+  return _param_mixtureServerCacheMemAlloc;
+}
+//-------------------------------------------------------------------------
+real_t Config::getParam_occPruningThreshold() const
+{
+  if (!existsParam_occPruningThreshold)
+    throw ParamNotFoundInConfigException("occPruningThreshold' in the config",
+                        __FILE__, __LINE__);
+  return _param_occPruningThreshold;
+}
+//-------------------------------------------------------------------------
+unsigned long Config::getParam_occPruningTopDistribsCount() const
+{
+  if (!existsParam_occPruningTopDistribsCount)
+    throw ParamNotFoundInConfigException("occPruningTopDistribsCount' in the config",
+                        __FILE__, __LINE__);
+  return _param_occPruningTopDistribsCount;
+}
+//-------------------------------------------------------------------------
 const FeatureFlags& Config::getParam_featureFlags() const
 {
   if (!existsParam_featureFlags)
@@ -687,6 +907,123 @@ void Config::setParam(const String& name, const String& content)
     _param_featureServerMask = content;
     existsParam_featureServerMask = true;
   }
+  else if (name == "featureServerSelectionCoef")
+  {
+    _param_featureServerSelectionCoef = content.toULong();
+    existsParam_featureServerSelectionCoef = true;
+  }
+  else if (name == "featureServerSelectionThreshold")
+  {
+    _param_featureServerSelectionThreshold = content.toDouble();
+    existsParam_featureServerSelectionThreshold = true;
+  }
+  else if (name == "featureServerNormalization")
+  {
+    if (content != "MEAN" && content != "MEAN_VARIANCE")
+      throw Exception("parameter '"+name+
+        "' must be 'MEAN' or 'MEAN_VARIANCE'", __FILE__, __LINE__);
+    _param_featureServerNormalization = content;
+    existsParam_featureServerNormalization = true;
+  }
+  else if (name == "featureServerNormalizationWindow")
+  {
+    _param_featureServerNormalizationWindow = content.toULong();
+    existsParam_featureServerNormalizationWindow = true;
+  }
+  else if (name == "featureServerDeltaWindow")
+  {
+    _param_featureServerDeltaWindow = content.toULong();
+    if (_param_featureServerDeltaWindow == 0)
+      throw Exception("parameter '"+name+"' cannot be 0",
+              __FILE__, __LINE__);
+    existsParam_featureServerDeltaWindow = true;
+  }
+  else if (name == "featureServerDeltaDelta")
+  {
+    _param_featureServerDeltaDelta = content.toBool();
+    existsParam_featureServerDeltaDelta = true;
+  }
+  else if (name == "featureComputerFrameLength")
+  {
+    _param_featureComputerFrameLength = content.toDouble();
+    if (_param_featureComputerFrameLength <= 0.0)
+      throw Exception("parameter '"+name+"' must be > 0", __FILE__, __LINE__);
+    existsParam_featureComputerFrameLength = true;
+  }
+  else if (name == "featureComputerFrameShift")
+  {
+    _param_featureComputerFrameShift = content.toDouble();
+    if (_param_featureComputerFrameShift <= 0.0)
+      throw Exception("parameter '"+name+"' must be > 0", __FILE__, __LINE__);
+    existsParam_featureComputerFrameShift = true;
+  }
+  else if (name == "featureComputerPreEmphasis")
+  {
+    _param_featureComputerPreEmphasis = content.toDouble();
+    existsParam_featureComputerPreEmphasis = true;
+  }
+  else if (name == "featureComputerFilterCount")
+  {
+    _param_featureComputerFilterCount = content.toULong();
+    if (_param_featureComputerFilterCount == 0)
+      throw Exception("parameter '"+name+"' cannot be 0", __FILE__, __LINE__);
+    existsParam_featureComputerFilterCount = true;
+  }
+  else if (name == "featureComputerCepstralCount")
+  {
+    _param_featureComputerCepstralCount = content.toULong();
+    if (_param_featureComputerCepstralCount == 0)
+      throw Exception("parameter '"+name+"' cannot be 0", __FILE__, __LINE__);
+    existsParam_featureComputerCepstralCount = true;
+  }
+  else if (name == "featureComputerEnergy")
+  {
+    _param_featureComputerEnergy = content.toBool();
+    existsParam_featureComputerEnergy = true;
+  }
+  else if (name == "featureComputerMinFrequency")
+  {
+    _param_featureComputerMinFrequency = content.toDouble();
+    existsParam_featureComputerMinFrequency = true;
+  }
+  else if (name == "featureComputerMaxFrequency")
+  {
+    _param_featureComputerMaxFrequency = content.toDouble();
+    existsParam_featureComputerMaxFrequency = true;
+  }
+  else if (name == "saveFeatureFileBigEndian")
+  {
+    _param_saveFeatureFileBigEndian = content.toBool();
+    existsParam_saveFeatureFileBigEndian = true;
+  }
+  else if (name == "topDistribsCacheFilesPath")
+  {
+    _param_topDistribsCacheFilesPath = content;
+    existsParam_topDistribsCacheFilesPath = true;
+  }
+  else if (name == "topDistribsCacheFileExtension")
+  {
+    _param_topDistribsCacheFileExtension = content;
+    existsParam_topDistribsCacheFileExtension = true;
+  }
+  else if (name == "mixtureServerCacheMemAlloc")
+  {
+    _param_mixtureServerCacheMemAlloc = content.toULong();
+    existsParam_mixtureServerCacheMemAlloc = true;
+  }
+  else if (name == "occPruningThreshold")
+  {
+    _param_occPruningThreshold = content.toDouble();
+    if (_param_occPruningThreshold < 0.0 || _param_occPruningThreshold >= 1.0)
+      throw Exception("parameter '"+name+"' must be in [0.0, 1.0[",
+               __FILE__, __LINE__);
+    existsParam_occPruningThreshold = true;
+  }
+  else if (name == "occPruningTopDistribsCount")
+  {
+    _param_occPruningTopDistribsCount = content.toULong();
+    existsParam_occPruningTopDistribsCount = true;
+  }
   else if (name == "featureFlags")
   {
     _param_featureFlags.set(content);
@@ -868,10 +1205,7 @@ void Config::setParam(const String& name, const String& content)
     existsParam_debug = true;
   }
 
-  _set.rewind();
-  XLine* p;
-  while( (p=_set.getLine()) != NULL && p->getElement(0) != name)
-    ;
+  XLine* p = _set.findLine(name);
   if (p == NULL)
     _set.addLine().addElement(name).addElement(content);
   else
@@ -0,0 +1,206 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_Counters_cpp)
+#define ALIZE_Counters_cpp
+
+#if defined(_WIN32)
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "Counters.h"
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+using namespace alize;
+typedef Counters C;
+
+bool C::_enabled = false;
+unsigned long long C::_values[C::COUNTER_COUNT];
+
+// 64 bits versions of the atomic operations of the object counters
+// (Object.cpp)
+#if defined(_MSC_VER)
+#include <intrin.h>
+static void atomicAdd(unsigned long long& x, unsigned long long n)
+{ _InterlockedExchangeAdd64((volatile __int64*)&x, (__int64)n); }
+static unsigned long long atomicExchange(unsigned long long& x,
+                                         unsigned long long n)
+{
+  return (unsigned long long)_InterlockedExchange64((volatile __int64*)&x,
+                                                    (__int64)n);
+}
+static unsigned long long atomicLoad(unsigned long long& x)
+{ return (unsigned long long)_InterlockedOr64((volatile __int64*)&x, 0); }
+#else
+static void atomicAdd(unsigned long long& x, unsigned long long n)
+{ __sync_fetch_and_add(&x, n); }
+static unsigned long long atomicExchange(unsigned long long& x,
+                                         unsigned long long n)
+{ return __sync_lock_test_and_set(&x, n); }
+static unsigned long long atomicLoad(unsigned long long& x)
+{ return __sync_fetch_and_add(&x, 0ULL); }
+#endif
+
+namespace
+{
+  const char* const names[C::COUNTER_COUNT] =
+  {
+    "fileBytesRead",
+    "fileSeeks",
+    "featuresRead",
+    "featureBufferLoads",
+    "llkDistribEvaluations",
+    "topDistribsCacheHits",
+    "emFeatures",
+    "emDistribsUpdated",
+    "featureBufferLoadTimeUs",
+    "llkTimeUs",
+    "emTimeUs"
+  };
+
+  // not a String : it must stay valid until the atexit() functions
+  char dumpFileName[FILENAME_MAX];
+
+  void dump()
+  {
+    const bool toStderr = strcmp(dumpFileName, "-") == 0;
+    FILE* f = toStderr ? stderr : fopen(dumpFileName, "w");
+    if (f == NULL)
+      return;
+    fprintf(f, "%s\n", C::toJSON().c_str());
+    if (!toStderr)
+      fclose(f);
+  }
+
+  // ALIZE_COUNTERS=<file> enables the counters and dumps them at exit
+  struct EnvironmentSetup
+  {
+    EnvironmentSetup()
+    {
+      const char* p = getenv("ALIZE_COUNTERS");
+      if (p != NULL && *p != 0)
+      {
+        C::setEnabled(true);
+        C::dumpAtExit(p);
+      }
+    }
+  } environmentSetup;
+}
+//-------------------------------------------------------------------------
+void C::setEnabled(bool b) { _enabled = b; }
+//-------------------------------------------------------------------------
+void C::increase(Id id, unsigned long long n) // private
+{ atomicAdd(_values[id], n); }
+//-------------------------------------------------------------------------
+unsigned long long C::get(Id id) { return atomicLoad(_values[id]); }
+//-------------------------------------------------------------------------
+const char* C::getName(Id id) { return names[id]; }
+//-------------------------------------------------------------------------
+void C::reset()
+{
+  for (unsigned long i=0; i<COUNTER_COUNT; i++)
+    atomicExchange(_values[i], 0);
+}
+//-------------------------------------------------------------------------
+String C::toJSON()
+{
+  String s = "{";
+  char value[24]; // String::valueOf() has no 64 bits version
+  for (unsigned long i=0; i<COUNTER_COUNT; i++)
+  {
+    if (i != 0)
+      s += ", ";
+    sprintf(value, "%llu", get(Id(i)));
+    s += String("\"") + names[i] + "\":" + value;
+  }
+  return s + "}";
+}
+//-------------------------------------------------------------------------
+void C::dumpAtExit(const FileName& f)
+{
+  const bool registered = dumpFileName[0] != 0;
+  strncpy(dumpFileName, f.c_str(), FILENAME_MAX-1);
+  if (!registered)
+    atexit(dump);
+}
+//-------------------------------------------------------------------------
+unsigned long long C::getTime()
+{
+#if defined(_WIN32)
+  static LARGE_INTEGER frequency;
+  if (frequency.QuadPart == 0)
+    QueryPerformanceFrequency(&frequency);
+  LARGE_INTEGER t;
+  QueryPerformanceCounter(&t);
+  const LONGLONG f = frequency.QuadPart;
+  return (unsigned long long)(t.QuadPart/f*1000000
+                             + t.QuadPart%f*1000000/f);
+#else
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (unsigned long long)t.tv_sec*1000000 + t.tv_nsec/1000;
+#endif
+}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_Counters_cpp)
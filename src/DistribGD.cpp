@@ -75,18 +75,86 @@
 #include "Feature.h"
 #include "Exception.h"
 #include "Config.h"
+#include "Mixture.h"
 
 using namespace alize;
 using namespace std;
 
+namespace
+{
+  // The squared distance is summed in 4 independent partial sums to
+  // break the dependency between the additions (the last vectSize%4
+  // values are added to the first sum). When n is a constant known at
+  // compile time, the end of the loop and the tail are known too.
+  inline real_t computeDistance(const real_t* f, const real_t* m,
+                                const real_t* c, unsigned long n)
+  {
+    real_t s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    const unsigned long n4 = n-n%4;
+    unsigned long i = 0;
+    for (; i<n4; i+=4)
+    {
+      const real_t d0 = f[i]-m[i], d1 = f[i+1]-m[i+1];
+      const real_t d2 = f[i+2]-m[i+2], d3 = f[i+3]-m[i+3];
+      s0 += d0*d0*c[i];
+      s1 += d1*d1*c[i+1];
+      s2 += d2*d2*c[i+2];
+      s3 += d3*d3*c[i+3];
+    }
+    for (; i<n; i++)
+    {
+      const real_t d = f[i]-m[i];
+      s0 += d*d*c[i];
+    }
+    return (s0+s1)+(s2+s3);
+  }
+}
+//-------------------------------------------------------------------------
+inline lk_t DistribGD::computeLKFromDistance(real_t cst, real_t distance)
+{  // private
+  const lk_t lk = cst*exp(-0.5*distance);
+  if (ISNAN(lk))
+    return EPS_LK;
+  return lk;
+}
+//-------------------------------------------------------------------------
+template <unsigned long N> lk_t DistribGD::computeLKFixed(const real_t* f,
+       const real_t* m, const real_t* c, real_t cst, unsigned long) // private
+{ return computeLKFromDistance(cst, computeDistance(f, m, c, N)); }
+//-------------------------------------------------------------------------
+lk_t DistribGD::computeLKGeneric(const real_t* f, const real_t* m,
+       const real_t* c, real_t cst, unsigned long n) // private
+{ return computeLKFromDistance(cst, computeDistance(f, m, c, n)); }
+//-------------------------------------------------------------------------
+DistribGD::LKKernel DistribGD::getLKKernel(unsigned long vectSize)
+{
+  switch (vectSize)
+  {
+    case 20: return computeLKFixed<20>;
+    case 39: return computeLKFixed<39>;
+    case 40: return computeLKFixed<40>;
+    case 50: return computeLKFixed<50>;
+    case 60: return computeLKFixed<60>;
+    default: return computeLKGeneric;
+  }
+}
+//-------------------------------------------------------------------------
+DistribGD::LKKernel DistribGD::getLKKernel(const Mixture& m)
+{
+  if (m.getType() != DistribType_GD)
+    return NULL;
+  return getLKKernel(m.getVectSize());
+}
 //-------------------------------------------------------------------------
 DistribGD::DistribGD(unsigned long vectSize)
- :Distrib(vectSize), _covInvVect(_vectSize, _vectSize)
+ :Distrib(vectSize), _covInvVect(_vectSize, _vectSize),
+ _lkKernel(getLKKernel(_vectSize))
 { reset(); }
 //-------------------------------------------------------------------------
 DistribGD::DistribGD(const Config& c)
  :Distrib(c.getParam_vectSize()>0?c.getParam_vectSize():1),
- _covInvVect(_vectSize, _vectSize) { reset(); }
+ _covInvVect(_vectSize, _vectSize), _lkKernel(getLKKernel(_vectSize))
+{ reset(); }
 //-------------------------------------------------------------------------
 void DistribGD::reset() // random init
 {
@@ -112,7 +180,8 @@ DistribGD& DistribGD::create(const K&, const Config& c)
 { return create(K::k, c.getParam_vectSize()); }
 //-------------------------------------------------------------------------
 DistribGD::DistribGD(const DistribGD& d)
-:Distrib(d._vectSize), _covVect(d._covVect), _covInvVect(d._covInvVect)
+:Distrib(d._vectSize), _covVect(d._covVect), _covInvVect(d._covInvVect),
+ _lkKernel(d._lkKernel)
 {
   _meanVect = d._meanVect;
   _det = d._det;
@@ -158,26 +227,13 @@ Distrib& DistribGD::clone() const // private
   return *p;
 }
 //-------------------------------------------------------------------------
-// TODO : A OPTIMISER !!
-//-------------------------------------------------------------------------
 lk_t DistribGD::computeLK(const Feature& frame) const
 {
   if (frame.getVectSize() != _vectSize)
     throw Exception("distrib vectSize ("
         + String::valueOf(_vectSize) + ") != feature vectSize ("
       + String::valueOf(frame.getVectSize()) + ")", __FILE__, __LINE__);
-  real_t tmp = 0.0;
-  real_t*      m = _meanVect.getArray();
-  real_t*      c = _covInvVect.getArray();
-  Feature::data_t* f = frame.getDataVector();
-
-  for (unsigned long i=0; i<_vectSize; i++)
-    tmp += (f[i] - m[i]) * (f[i] - m[i]) * c[i];
-
-  tmp = _cst * exp(-0.5*tmp);
-  if (ISNAN(tmp))
-    return EPS_LK;
-  return tmp;
+  return computeLK(K::k, _lkKernel, frame.getDataVector());
 }
 //-------------------------------------------------------------------------
 lk_t DistribGD::computeLK(const Feature& frame, unsigned long i) const
@@ -191,7 +247,19 @@ lk_t DistribGD::computeLK(const Feature& frame, unsigned long i) const
 //-------------------------------------------------------------------------
 void DistribGD::computeAll()
 {
-  real_t* vect = getCovVect().getArray();
+  computeAllFromCov(getCovVect().getArray());
+  _covVect.setSize(0, true); // set capacity to 0 too
+}
+//-------------------------------------------------------------------------
+void DistribGD::computeAll(const K&, const real_t* cov)
+{
+  computeAllFromCov(cov);
+  if (_covVect.size() != 0)
+    _covVect.setSize(0, true);
+}
+//-------------------------------------------------------------------------
+void DistribGD::computeAllFromCov(const real_t* vect) // private
+{
   assert(vect != NULL);
   unsigned long i;
 
@@ -217,9 +285,6 @@ void DistribGD::computeAll()
     _cst = 1.0 / ( pow(_det, 0.5) * pow( PI2 , _vectSize/2.0 ) );
   else
     _cst = 1.0 / ( pow(EPS_LK, 0.5) * pow( PI2 , _vectSize/2.0 ) );
-
-  //
-  _covVect.setSize(0, true); // set capacity to 0 too
 }
 //-------------------------------------------------------------------------
 void DistribGD::setCov(real_t v, unsigned long i)
@@ -237,7 +302,13 @@ real_t DistribGD::getCov(unsigned long i)
 { return getCovVect()[i];}
 //-------------------------------------------------------------------------
 real_t DistribGD::getCov(unsigned long i) const 
-{ return getCovVect()[i];}
+{
+  if (_covVect.size() == _vectSize)
+    return _covVect[i];
+  // computed without building _covVect : the distribution is not modified
+  const real_t v = _covInvVect[i];
+  return v < 1.0/MIN_COV ? 1.0/v : MIN_COV;
+}
 //-------------------------------------------------------------------------
 real_t DistribGD::getCovInv(unsigned long i) const {return _covInvVect[i];}
 //-------------------------------------------------------------------------
@@ -81,14 +81,16 @@
 using namespace alize;
 using namespace std;
 
+static const unsigned long LOCAL_BUFFER_SIZE = 256;
+
 //-------------------------------------------------------------------------
 DistribGF::DistribGF(const unsigned long vectSize)
  :Distrib(vectSize), _covInvMatr(_vectSize),
- _cst(0.0), _tmpVect(_vectSize) {}
+ _cst(0.0) {}
 //-------------------------------------------------------------------------
 DistribGF::DistribGF(const Config& c)
  :Distrib(c.getParam_vectSize()>0?c.getParam_vectSize():1),
- _covInvMatr(_vectSize), _cst(0.0), _tmpVect(_vectSize) {}
+ _covInvMatr(_vectSize), _cst(0.0) {}
 //-------------------------------------------------------------------------
 void DistribGF::reset() // random init
 {
@@ -122,7 +124,7 @@ DistribGF& DistribGF::create(const K&, const Config& c)
 //-------------------------------------------------------------------------
 DistribGF::DistribGF(const DistribGF& d)
 :Distrib(d._vectSize), _covMatr(d._covMatr), _covInvMatr(d._covInvMatr),
- _cst(d._cst), _tmpVect(d._vectSize)
+ _cst(d._cst)
 {
   _meanVect = d._meanVect;
   _det = d._det;
@@ -185,9 +187,16 @@ lk_t DistribGF::computeLK(const Feature& frame) const
   real_t tmp2;
   unsigned long i, j, ii;
   real_t*      m = _meanVect.getArray();
-  real_t*      x = _tmpVect.getArray();
   real_t*      c = _covInvMatr.getArray();
   Feature::data_t* f = frame.getDataVector();
+  // local buffer : the distribution is not modified (reentrant)
+  real_t  buffer[LOCAL_BUFFER_SIZE];
+  real_t* x = buffer;
+  if (_vectSize > LOCAL_BUFFER_SIZE)
+  {
+    x = new (std::nothrow) real_t[_vectSize];
+    assertMemoryIsAllocated(x, __FILE__, __LINE__);
+  }
 
   for (j=0; j<_vectSize; j++)
     x[j] = f[j] - m[j];
@@ -199,6 +208,8 @@ lk_t DistribGF::computeLK(const Feature& frame) const
       tmp2 += x[j] * c[j+ii];
     tmp += tmp2 * x[i];
   }
+  if (x != buffer)
+    delete [] x;
 
   tmp = _cst * exp(-0.5*tmp);
   if (ISNAN(tmp))
@@ -158,6 +158,17 @@ void DistribRefVector::deleteUnreferencedDistrib(const Distrib& d)
   throw Exception("Distrib not found in the vector", __FILE__, __LINE__);
 }
 //-------------------------------------------------------------------------
+bool DistribRefVector::deleteUnreferencedDistribFast(unsigned long i)
+{
+  assertIsInBounds(__FILE__, __LINE__, i, _size);
+  assert(_array != NULL);
+  if (_array[i]->refCounter(K::k) != 1)
+    return false;
+  delete _array[i];
+  _array[i] = _array[--_size];
+  return true;
+}
+//-------------------------------------------------------------------------
 Distrib** DistribRefVector::getArray() const { return _array; }
 //-------------------------------------------------------------------------
 unsigned long DistribRefVector::size() const { return _size; }
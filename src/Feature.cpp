@@ -62,6 +62,7 @@
 #include "Exception.h"
 #include "Config.h"
 #include "ULongVector.h"
+#include "Allocator.h"
 
 using namespace alize;
 
@@ -123,7 +124,8 @@ bool Feature::operator!=(const Feature& c) const { return !(*this == c); }
 //-------------------------------------------------------------------------
 Feature::data_t* Feature::createVector() const // private
 {
-  data_t* p = new (std::nothrow) data_t[_vectSize==0?1:_vectSize];
+  data_t* p = static_cast<data_t*>(Allocator::allocateAligned(
+              (_vectSize==0?1:_vectSize)*sizeof(data_t)));
   assertMemoryIsAllocated(p, __FILE__, __LINE__);
   return p;
 }
@@ -168,7 +170,7 @@ void Feature::setVectSize(const K&, unsigned long s)
   {
     // all data are lost
     assert(_dataVector != NULL);
-    delete [] _dataVector;
+    Allocator::deallocateAligned(_dataVector);
     _vectSize = s;
     _dataVector = createVector();
   }
@@ -231,7 +233,7 @@ String Feature::toString() const
 Feature::~Feature()
 {
   assert(_dataVector != NULL);
-  delete[] _dataVector;
+  Allocator::deallocateAligned(_dataVector);
 }
 //-------------------------------------------------------------------------
 
@@ -0,0 +1,180 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_FeatureBlock_cpp)
+#define ALIZE_FeatureBlock_cpp
+
+#include <new>
+#include "FeatureBlock.h"
+#include "Exception.h"
+
+using namespace alize;
+typedef FeatureBlock B;
+
+//-------------------------------------------------------------------------
+B::FeatureBlock(unsigned long vectSize)
+:Object(), _vectSize(vectSize), _featureCount(0) {}
+//-------------------------------------------------------------------------
+B& B::create(unsigned long vectSize)
+{
+  B* p = new (std::nothrow) B(vectSize);
+  assertMemoryIsAllocated(p, __FILE__, __LINE__);
+  return *p;
+}
+//-------------------------------------------------------------------------
+unsigned long B::getFeatureCount() const { return _featureCount; }
+//-------------------------------------------------------------------------
+unsigned long B::getVectSize() const { return _vectSize; }
+//-------------------------------------------------------------------------
+void B::setVectSize(unsigned long vectSize)
+{
+  if (vectSize == _vectSize)
+    return;
+  _vectSize = vectSize;
+  _featureCount = 0;
+  _data.setSize(0);
+  _labelCodes.setSize(0);
+  _validities.setSize(0);
+}
+//-------------------------------------------------------------------------
+void B::setFeatureCount(unsigned long n)
+{
+  if (n > _validities.size()) // the capacity grows geometrically
+  {
+    unsigned long c = 2*_validities.size();
+    if (c < n)
+      c = n;
+    _data.setSize(c*_vectSize);
+    _labelCodes.setSize(c);
+    _validities.setSize(c);
+  }
+  _featureCount = n;
+}
+//-------------------------------------------------------------------------
+Feature::data_t* B::getDataMatrix() const { return _data.getArray(); }
+//-------------------------------------------------------------------------
+Feature::data_t* B::getDataVector(unsigned long i) const
+{
+  assertIsInBounds(__FILE__, __LINE__, i, _featureCount);
+  return _data.getArray()+i*_vectSize;
+}
+//-------------------------------------------------------------------------
+bool B::isValid(unsigned long i) const { return _validities[i] != 0; }
+//-------------------------------------------------------------------------
+void B::setValidity(unsigned long i, bool v) { _validities[i] = v ? 1 : 0; }
+//-------------------------------------------------------------------------
+unsigned long B::getLabelCode(unsigned long i) const
+{ return _labelCodes[i]; }
+//-------------------------------------------------------------------------
+void B::setLabelCode(unsigned long i, unsigned long c)
+{ _labelCodes[i] = c; }
+//-------------------------------------------------------------------------
+void B::getFeature(unsigned long i, Feature& f) const
+{
+  const Feature::data_t* v = getDataVector(i);
+  f.setVectSize(K::k, _vectSize);
+  Feature::data_t* d = f.getDataVector();
+  for (unsigned long j=0; j<_vectSize; j++)
+    d[j] = v[j];
+  f.setValidity(isValid(i));
+  f.setLabelCode(getLabelCode(i));
+}
+//-------------------------------------------------------------------------
+void B::setFeature(unsigned long i, const Feature& f)
+{
+  if (f.getVectSize() != _vectSize)
+    throw Exception("incompatible vectSize ("
+          + String::valueOf(f.getVectSize()) + "/"
+          + String::valueOf(_vectSize) + ")", __FILE__, __LINE__);
+  Feature::data_t* v = getDataVector(i);
+  const Feature::data_t* d = f.getDataVector();
+  for (unsigned long j=0; j<_vectSize; j++)
+    v[j] = d[j];
+  setValidity(i, f.isValid());
+  setLabelCode(i, f.getLabelCode());
+}
+//-------------------------------------------------------------------------
+void B::selectComponents(const ULongVector& selection)
+{
+  const unsigned long n = selection.size();
+  const unsigned long* s = selection.getArray();
+  for (unsigned long j=0; j<n; j++)
+    if (s[j] >= _vectSize || (j != 0 && s[j] <= s[j-1]))
+      throw Exception("Invalid selection of components",
+                      __FILE__, __LINE__);
+  // s[j] >= j so the rows can be packed from the beginning
+  Feature::data_t* d = _data.getArray();
+  for (unsigned long i=0; i<_featureCount; i++)
+  {
+    const Feature::data_t* in = d+i*_vectSize;
+    Feature::data_t* out = d+i*n;
+    for (unsigned long j=0; j<n; j++)
+      out[j] = in[s[j]];
+  }
+  _vectSize = n;
+}
+//-------------------------------------------------------------------------
+String B::getClassName() const { return "FeatureBlock"; }
+//-------------------------------------------------------------------------
+String B::toString() const
+{
+  return Object::toString()
+    + "\n  vectSize = " + String::valueOf(_vectSize)
+    + "\n  feature count = " + String::valueOf(_featureCount);
+}
+//-------------------------------------------------------------------------
+B::~FeatureBlock() {}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_FeatureBlock_cpp)
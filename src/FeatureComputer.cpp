@@ -0,0 +1,488 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_FeatureComputer_cpp)
+#define ALIZE_FeatureComputer_cpp
+
+#include <new>
+#include <cmath>
+#include <cstring>
+#include <climits>
+#include "FeatureComputer.h"
+#include "AudioInputStream.h"
+#include "Config.h"
+#include "Exception.h"
+
+using namespace alize;
+typedef FeatureComputer M;
+
+static const unsigned long CHUNK_SAMPLE_COUNT = 4096; // samples read at once
+static const double LOG_FLOOR = 1e-10;
+static const double PI = 3.14159265358979323846;
+
+//-------------------------------------------------------------------------
+static double mel(double f) { return 2595.0*log10(1.0+f/700.0); }
+//-------------------------------------------------------------------------
+M::FeatureComputer(AudioInputStream& a, const Config& c,
+                   const String& sourceName, bool ownStream)
+:FeatureInputStream(c), _pInput(&a), _ownStream(ownStream),
+ _sourceName(sourceName), _paramDefined(false), _frameRate(0.0),
+ _frameLength(0), _frameShift(0), _fftSize(0), _filterCount(0),
+ _cepstralCount(0), _useEnergy(false), _preEmphasis(0.0),
+ _featureCount(0), _samplesIndex(0), _inputIdx(ULONG_MAX), _pos(0) {}
+//-------------------------------------------------------------------------
+M& M::create(AudioInputStream& a, const Config& c,
+             const String& sourceName, bool ownStream)
+{
+  M* p = new (std::nothrow) M(a, c, sourceName, ownStream);
+  assertMemoryIsAllocated(p, __FILE__, __LINE__);
+  return *p;
+}
+//-------------------------------------------------------------------------
+void M::defineParams() // private
+{
+  if (_paramDefined)
+    return;
+  const Config& c = getConfig();
+  _frameRate = _pInput->getFrameRate();
+  const double length = c.existsParam_featureComputerFrameLength ?
+                        c.getParam_featureComputerFrameLength() : 20.0;
+  const double shift = c.existsParam_featureComputerFrameShift ?
+                       c.getParam_featureComputerFrameShift() : 10.0;
+  _frameLength = (unsigned long)floor(length*_frameRate/1000.0+0.5);
+  _frameShift = (unsigned long)floor(shift*_frameRate/1000.0+0.5);
+  if (_frameLength == 0 || _frameShift == 0)
+    throw Exception("Frame length and shift must be at least one sample",
+                    __FILE__, __LINE__);
+  _preEmphasis = c.existsParam_featureComputerPreEmphasis ?
+                 c.getParam_featureComputerPreEmphasis() : 0.97;
+  _filterCount = c.existsParam_featureComputerFilterCount ?
+                 c.getParam_featureComputerFilterCount() : 24;
+  _cepstralCount = c.existsParam_featureComputerCepstralCount ?
+                   c.getParam_featureComputerCepstralCount() : 12;
+  if (_cepstralCount >= _filterCount)
+    throw Exception("featureComputerCepstralCount must be lower than "
+                    "featureComputerFilterCount", __FILE__, __LINE__);
+  _useEnergy = c.existsParam_featureComputerEnergy ?
+               c.getParam_featureComputerEnergy() : true;
+  const double minFrequency = c.existsParam_featureComputerMinFrequency ?
+                              c.getParam_featureComputerMinFrequency() : 0.0;
+  const double maxFrequency = c.existsParam_featureComputerMaxFrequency ?
+                  c.getParam_featureComputerMaxFrequency() : _frameRate/2.0;
+  if (minFrequency < 0.0 || minFrequency >= maxFrequency
+      || maxFrequency > _frameRate/2.0)
+    throw Exception("Wrong filter bank bounds : "
+        + String::valueOf(minFrequency) + " - "
+        + String::valueOf(maxFrequency) + " Hz", __FILE__, __LINE__);
+  _flags.set(_useEnergy ? "110000" : "100000");
+
+  const unsigned long frameCount = _pInput->getFrameCount();
+  _featureCount = frameCount < _frameLength ? 0 :
+                  1 + (frameCount-_frameLength)/_frameShift;
+  unsigned long i, k;
+  // Hamming window
+  _window.setSize(_frameLength);
+  for (i=0; i<_frameLength; i++)
+    _window[i] = _frameLength == 1 ? 1.0 :
+                 0.54-0.46*cos(2.0*PI*i/(double)(_frameLength-1));
+  _frame.setSize(_frameLength);
+  // FFT tables : bit reversal and the twiddle factors of each stage
+  // stored contiguously so the butterfly loops run on unit strides
+  unsigned long bits = 1;
+  for (_fftSize = 2; _fftSize < _frameLength; _fftSize *= 2)
+    bits++;
+  _bitReverse.setSize(_fftSize);
+  for (i=0; i<_fftSize; i++)
+  {
+    unsigned long r = 0;
+    for (k=0; k<bits; k++)
+      r = (r << 1) | ((i >> k) & 1);
+    _bitReverse[i] = r;
+  }
+  _twiddleRe.setSize(_fftSize-1);
+  _twiddleIm.setSize(_fftSize-1);
+  for (unsigned long h=1; h<_fftSize; h*=2)
+    for (k=0; k<h; k++)
+    {
+      _twiddleRe[h-1+k] = cos(-PI*k/(double)h);
+      _twiddleIm[h-1+k] = sin(-PI*k/(double)h);
+    }
+  _re.setSize(_fftSize);
+  _im.setSize(_fftSize);
+  _power.setSize(_fftSize/2+1);
+  initFilterBank(minFrequency, maxFrequency);
+  // DCT-II of the log energies (c0 excluded)
+  const double norm = sqrt(2.0/(double)_filterCount);
+  _dct.setSize(_cepstralCount*_filterCount);
+  for (i=0; i<_cepstralCount; i++)
+    for (k=0; k<_filterCount; k++)
+      _dct[i*_filterCount+k] = norm*cos(PI*(double)(i+1)*((double)k+0.5)
+                                        /(double)_filterCount);
+  _logEnergies.setSize(_filterCount);
+  _paramDefined = true;
+}
+//-------------------------------------------------------------------------
+void M::initFilterBank(double minFrequency, double maxFrequency) // private
+{ // triangular filters equally spaced on the mel scale. Only the non
+  // null weights of each filter are stored
+  const unsigned long binCount = _fftSize/2+1;
+  const double melMin = mel(minFrequency);
+  const double step = (mel(maxFrequency)-melMin)/(double)(_filterCount+1);
+  _filterFirstBin.setSize(_filterCount);
+  _filterOffset.setSize(_filterCount+1);
+  _filterWeights.setSize(0);
+  for (unsigned long j=0; j<_filterCount; j++)
+  {
+    const double lo = melMin + step*(double)j;
+    const double mid = lo + step;
+    const double hi = mid + step;
+    const unsigned long offset = _filterWeights.size();
+    _filterOffset[j] = offset;
+    _filterFirstBin[j] = 0;
+    for (unsigned long k=0; k<binCount; k++)
+    {
+      const double m = mel((double)k*_frameRate/(double)_fftSize);
+      if (m <= lo)
+        continue;
+      if (m >= hi)
+        break;
+      if (_filterWeights.size() == offset)
+        _filterFirstBin[j] = k;
+      _filterWeights.addValue(m <= mid ? (m-lo)/step : (hi-m)/step);
+    }
+    if (_filterWeights.size() == offset)
+      throw Exception("Empty mel filter #" + String::valueOf(j)
+          + " : too many filters for the frame length", __FILE__, __LINE__);
+  }
+  _filterOffset[_filterCount] = _filterWeights.size();
+}
+//-------------------------------------------------------------------------
+bool M::loadSamples(unsigned long b, unsigned long e) // private
+{ // makes _samples contain at least the samples [b, e)
+  unsigned long end = _samplesIndex + _samples.size();
+  if (b < _samplesIndex || b > end)
+  {
+    _samples.setSize(0);
+    _samplesIndex = end = b;
+  }
+  if (end >= e)
+    return true;
+  if (b > _samplesIndex) // drops the samples before b
+  {
+    const unsigned long n = end-b;
+    memmove(_samples.getArray(), _samples.getArray()+(b-_samplesIndex),
+            n*sizeof(float));
+    _samples.setSize(n);
+    _samplesIndex = b;
+  }
+  while (end < e)
+  {
+    if (_inputIdx != end)
+      _pInput->seekFrame(end);
+    const unsigned long n = _pInput->readFrames(_chunk,
+                    e-end > CHUNK_SAMPLE_COUNT ? e-end : CHUNK_SAMPLE_COUNT);
+    if (n == 0)
+    {
+      _inputIdx = ULONG_MAX;
+      return false;
+    }
+    const unsigned long size = _samples.size();
+    _samples.setSize(size+n);
+    memcpy(_samples.getArray()+size, _chunk.getArray(), n*sizeof(float));
+    end += n;
+    _inputIdx = end;
+  }
+  return true;
+}
+//-------------------------------------------------------------------------
+void M::fft() // private
+{ // in place radix-2 FFT of (_re, _im), the input being in bit reversed
+  // order
+  const unsigned long n = _fftSize;
+  double* re = _re.getArray();
+  double* im = _im.getArray();
+  for (unsigned long h=1; h<n; h*=2)
+  {
+    const double* wr = _twiddleRe.getArray()+h-1;
+    const double* wi = _twiddleIm.getArray()+h-1;
+    for (unsigned long j=0; j<n; j+=2*h)
+    {
+      double* ar = re+j;
+      double* ai = im+j;
+      double* br = ar+h;
+      double* bi = ai+h;
+      for (unsigned long k=0; k<h; k++)
+      {
+        const double tr = br[k]*wr[k]-bi[k]*wi[k];
+        const double ti = br[k]*wi[k]+bi[k]*wr[k];
+        br[k] = ar[k]-tr;
+        bi[k] = ai[k]-ti;
+        ar[k] += tr;
+        ai[k] += ti;
+      }
+    }
+  }
+}
+//-------------------------------------------------------------------------
+bool M::computeFeature(unsigned long idx, Feature::data_t* out) // private
+{
+  const unsigned long n = _frameLength;
+  const unsigned long first = idx*_frameShift;
+  if (!loadSamples(first > 0 ? first-1 : 0, first+n))
+    return false;
+  const float* s = _samples.getArray()+(first-_samplesIndex);
+  const double a = _preEmphasis;
+  const double* w = _window.getArray();
+  double* x = _frame.getArray();
+  unsigned long i;
+  double energy = 0.0;
+  for (i=0; i<n; i++)
+    energy += (double)s[i]*(double)s[i];
+  // pre-emphasis and window
+  x[0] = (s[0]-a*(first > 0 ? s[-1] : s[0]))*w[0];
+  for (i=1; i<n; i++)
+    x[i] = (s[i]-a*s[i-1])*w[i];
+  // power spectrum
+  double* re = _re.getArray();
+  double* im = _im.getArray();
+  const unsigned long* rev = _bitReverse.getArray();
+  for (i=0; i<_fftSize; i++)
+    re[i] = im[i] = 0.0;
+  for (i=0; i<n; i++)
+    re[rev[i]] = x[i];
+  fft();
+  double* p = _power.getArray();
+  for (i=0; i<=_fftSize/2; i++)
+    p[i] = re[i]*re[i]+im[i]*im[i];
+  // filter bank
+  double* logE = _logEnergies.getArray();
+  for (unsigned long j=0; j<_filterCount; j++)
+  {
+    const double* fw = _filterWeights.getArray()+_filterOffset[j];
+    const double* fp = p+_filterFirstBin[j];
+    const unsigned long size = _filterOffset[j+1]-_filterOffset[j];
+    double e = 0.0;
+    for (i=0; i<size; i++)
+      e += fw[i]*fp[i];
+    logE[j] = log(e > LOG_FLOOR ? e : LOG_FLOOR);
+  }
+  // DCT
+  for (unsigned long c=0; c<_cepstralCount; c++)
+  {
+    const double* d = _dct.getArray()+c*_filterCount;
+    double v = 0.0;
+    for (i=0; i<_filterCount; i++)
+      v += d[i]*logE[i];
+    out[c] = v;
+  }
+  if (_useEnergy)
+    out[_cepstralCount] = log(energy > LOG_FLOOR ? energy : LOG_FLOOR);
+  return true;
+}
+//-------------------------------------------------------------------------
+void M::resolveSeek() // private
+{
+  if (_seekWanted)
+  {
+    _pos = _seekWantedIdx;
+    if (!_seekWantedSrcName.isEmpty())
+      _pos += getFirstFeatureIndexOfASource(_seekWantedSrcName);
+    _seekWanted = false;
+  }
+}
+//-------------------------------------------------------------------------
+bool M::readFeature(Feature& f, unsigned long step)
+{
+  defineParams();
+  resolveSeek();
+  _error = NO_ERROR;
+  if (_pos >= _featureCount)
+    return false;
+  f.setVectSize(K::k, getVectSize());
+  if (!computeFeature(_pos, f.getDataVector()))
+    return false;
+  f.setValidity(true);
+  _pos += step;
+  return true;
+}
+//-------------------------------------------------------------------------
+unsigned long M::readFeatures(FeatureBlock& b, unsigned long maxCount)
+{
+  defineParams();
+  resolveSeek();
+  _error = NO_ERROR;
+  b.setFeatureCount(0);
+  unsigned long n = 0;
+  if (_pos < _featureCount && maxCount != 0)
+  {
+    if (maxCount > _featureCount-_pos)
+      maxCount = _featureCount-_pos;
+    b.setVectSize(getVectSize());
+    b.setFeatureCount(maxCount);
+    for (; n<maxCount && computeFeature(_pos, b.getDataVector(n)); n++)
+    {
+      b.setValidity(n, true);
+      b.setLabelCode(n, 0);
+      _pos++;
+    }
+    b.setFeatureCount(n);
+  }
+  return n;
+}
+//-------------------------------------------------------------------------
+bool M::addFeature(const Feature& f)
+{ throw Exception("Feature adding forbidden", __FILE__, __LINE__); }
+//-------------------------------------------------------------------------
+unsigned long M::getFeatureCount()
+{
+  defineParams();
+  return _featureCount;
+}
+//-------------------------------------------------------------------------
+unsigned long M::getVectSize()
+{
+  defineParams();
+  return _useEnergy ? _cepstralCount+1 : _cepstralCount;
+}
+//-------------------------------------------------------------------------
+const FeatureFlags& M::getFeatureFlags()
+{
+  defineParams();
+  return _flags;
+}
+//-------------------------------------------------------------------------
+void M::seekFeature(unsigned long i, const String& s)
+{
+  _seekWanted = true;
+  _seekWantedIdx = i;
+  _seekWantedSrcName = s;
+}
+//-------------------------------------------------------------------------
+real_t M::getSampleRate()
+{
+  const Config& c = getConfig();
+  return 1000.0/(c.existsParam_featureComputerFrameShift ?
+                 c.getParam_featureComputerFrameShift() : 10.0);
+}
+//-------------------------------------------------------------------------
+void M::reset()
+{
+  _pInput->reset();
+  _inputIdx = ULONG_MAX;
+  _seekWanted = false;
+  _pos = 0;
+}
+//-------------------------------------------------------------------------
+void M::close() { _pInput->close(); }
+//-------------------------------------------------------------------------
+unsigned long M::getSourceCount() { return 1; }
+//-------------------------------------------------------------------------
+unsigned long M::getFeatureCountOfASource(unsigned long srcIdx)
+{
+  if (srcIdx != 0)
+    throw Exception("Only 1 source available", __FILE__, __LINE__);
+  return getFeatureCount();
+}
+//-------------------------------------------------------------------------
+unsigned long M::getFeatureCountOfASource(const String& s)
+{
+  if (s != _sourceName)
+    throw Exception("Wrong source name : " + s, __FILE__, __LINE__);
+  return getFeatureCount();
+}
+//-------------------------------------------------------------------------
+unsigned long M::getFirstFeatureIndexOfASource(unsigned long srcIdx)
+{
+  if (srcIdx != 0)
+    throw Exception("Only 1 source available", __FILE__, __LINE__);
+  return 0;
+}
+//-------------------------------------------------------------------------
+unsigned long M::getFirstFeatureIndexOfASource(const String& s)
+{
+  if (s != _sourceName)
+    throw Exception("Wrong source name : " + s, __FILE__, __LINE__);
+  return 0;
+}
+//-------------------------------------------------------------------------
+const String& M::getNameOfASource(unsigned long srcIdx)
+{
+  if (srcIdx != 0)
+    throw Exception("Only 1 source available", __FILE__, __LINE__);
+  return _sourceName;
+}
+//-------------------------------------------------------------------------
+String M::getClassName() const { return "FeatureComputer"; }
+//-------------------------------------------------------------------------
+String M::toString() const
+{
+  return FeatureInputStream::toString()
+    + "\n  audio stream = " + _pInput->getClassName()
+    + "[" + _pInput->getAddress() + "]"
+    + "\n  source name = '" + _sourceName + "'"
+    + "\n  frame length = " + String::valueOf(_frameLength) + " samples"
+    + "\n  frame shift = " + String::valueOf(_frameShift) + " samples"
+    + "\n  filter count = " + String::valueOf(_filterCount)
+    + "\n  cepstral count = " + String::valueOf(_cepstralCount)
+    + (_useEnergy ? "\n  energy = true" : "\n  energy = false");
+}
+//-------------------------------------------------------------------------
+M::~FeatureComputer()
+{
+  if (_ownStream)
+    delete _pInput;
+}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_FeatureComputer_cpp)
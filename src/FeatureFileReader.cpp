@@ -62,6 +62,7 @@
 #include "FeatureFileReaderSPro3.h"
 #include "FeatureFileReaderSPro4.h"
 #include "FeatureFileReaderHTK.h"
+#include "FeatureFileReaderAudio.h"
 #include "Feature.h"
 #include "Exception.h"
 #include "LabelServer.h"
@@ -119,6 +120,8 @@ FeatureFileReaderAbstract& R::createStream(const FileName& f,
         return FeatureFileReaderHTK::create(f, c, p, be, b, bufferSize, h, historicSize);
     case FeatureFileReaderFormat_RAW:
         return FeatureFileReaderRaw::create(f, c, p, be, b, bufferSize, h, historicSize);
+    case FeatureFileReaderFormat_AUDIO:
+        return FeatureFileReaderAudio::create(f, c, p, be, b, bufferSize, h, historicSize);
     }
   throw Exception("Param 'loadFeatureFileFormat' expected in the config",
                   __FILE__, __LINE__);
@@ -170,6 +173,51 @@ bool R::readFeature(Feature& f, unsigned long step)
   return ok;
 }
 //-------------------------------------------------------------------------
+unsigned long R::readFeatures(FeatureBlock& b, unsigned long maxCount)
+{
+  if (_pFeatureReader == NULL)
+    return 0;
+  if (_seekWanted)
+  {
+    _seekWanted = false;
+    _pFeatureReader->seekFeature(_seekWantedIdx, _seekWantedSrcName);
+  }
+  unsigned long n = _pFeatureReader->readFeatures(b, maxCount);
+  _error = _pFeatureReader->getError();
+  return n;
+}
+//-------------------------------------------------------------------------
+bool R::readSelectedFeature(Feature& f, const ULongVector& selection,
+                            unsigned long step)
+{
+  if (_pFeatureReader == NULL)
+    return false;
+  if (_seekWanted)
+  {
+    _seekWanted = false;
+    _pFeatureReader->seekFeature(_seekWantedIdx, _seekWantedSrcName);
+  }
+  bool ok = _pFeatureReader->readSelectedFeature(f, selection, step);
+  _error = _pFeatureReader->getError();
+  return ok;
+}
+//-------------------------------------------------------------------------
+unsigned long R::readSelectedFeatures(FeatureBlock& b,
+              unsigned long maxCount, const ULongVector& selection)
+{
+  if (_pFeatureReader == NULL)
+    return 0;
+  if (_seekWanted)
+  {
+    _seekWanted = false;
+    _pFeatureReader->seekFeature(_seekWantedIdx, _seekWantedSrcName);
+  }
+  unsigned long n = _pFeatureReader->readSelectedFeatures(b, maxCount,
+                                                          selection);
+  _error = _pFeatureReader->getError();
+  return n;
+}
+//-------------------------------------------------------------------------
 bool R::addFeature(const Feature& f)
 {
   if (_pFeatureReader == NULL)
@@ -64,9 +64,13 @@
 #include "FeatureFlags.h"
 #include "Config.h"
 #include "RealVector.h"
+#include "FeatureBlock.h"
+#include "ULongVector.h"
 #include "FileReader.h"
+#include "Counters.h"
 
 #include <iostream>
+#include <cstring>
 
 using namespace alize;
 typedef FeatureFileReaderSingle R;
@@ -79,7 +83,8 @@ R::FeatureFileReaderSingle(FileReader* r, FeatureInputStream* st,
 :FeatureFileReaderAbstract(NULL, c, p, b, bufferSize, h, historicSize),
  _pReader(r), _pFeatureInputStream(st), _pFeature(NULL), _featureIndex(0),
  _lastFeatureIndex(0),
- _featureIndexOfBuffer(0), _nbStored(0), _pBuffer(&FloatVector::create())
+ _featureIndexOfBuffer(0), _nbStored(0), _pBuffer(&FloatVector::create()),
+ _labelCode(-1), _selectionSize(0)
 {}
 //-------------------------------------------------------------------------
 String R::getPath(const FileName& f, const Config& c) const
@@ -119,14 +124,31 @@ void R::close()
 }
 //-------------------------------------------------------------------------
 bool R::readFeature(Feature& f, unsigned long step)
+{ return readOne(f, step, NULL); }
+//-------------------------------------------------------------------------
+bool R::readSelectedFeature(Feature& f, const ULongVector& selection,
+                            unsigned long step)
+{ return readOne(f, step, &selection); }
+//-------------------------------------------------------------------------
+unsigned long R::readFeatures(FeatureBlock& b, unsigned long maxCount)
+{ return readBlock(b, maxCount, NULL); }
+//-------------------------------------------------------------------------
+unsigned long R::readSelectedFeatures(FeatureBlock& b,
+              unsigned long maxCount, const ULongVector& selection)
+{ return readBlock(b, maxCount, &selection); }
+//-------------------------------------------------------------------------
+bool R::readOne(Feature& f, unsigned long step,
+                const ULongVector* pSelection) // private
 {
   assert(_pReader != NULL || _pFeatureInputStream != NULL);
+  const unsigned long outVectSize = (pSelection != NULL) ?
+                                    pSelection->size() : getVectSize();
   if (_seekWanted)
   {
     _seekWanted = false;
     if (_historicUsage == LIMITED && !featureWantedIsInHistoric())
     {
-      f.setVectSize(K::k, getVectSize());
+      f.setVectSize(K::k, outVectSize);
       f.setValidity(false);
       _error = FEATURE_OUT_OF_HISTORY;
       return true;
@@ -140,94 +162,241 @@ bool R::readFeature(Feature& f, unsigned long step)
   // si on demande une feature hors du buffer
   if (_featureIndex < _featureIndexOfBuffer ||
       _featureIndex >= _featureIndexOfBuffer + _nbStored)
+    loadBuffer(featureCount, 1);
+  f.setVectSize(K::k, outVectSize);
+  if (pSelection == NULL)
+    f.setData(*_pBuffer, (_featureIndex-_featureIndexOfBuffer)*getVectSize());
+  else
   {
-    if (!_bufferSizeDefined)
+    setSelectionRuns(*pSelection);
+    copySelectedData(_pBuffer->getArray()
+                     + (_featureIndex-_featureIndexOfBuffer)*getVectSize(),
+                     f.getDataVector(), 1);
+  }
+  f.setValidity(true);
+  Counters::add(Counters::FEATURES_READ, 1);
+
+  _featureIndex += step;
+  if (_featureIndex > _lastFeatureIndex)
+    _lastFeatureIndex = _featureIndex;
+  if (_pLabelServer != NULL)
+    f.setLabelCode(getSourceLabelCode());
+  _error = NO_ERROR;
+  return true;
+}
+//-------------------------------------------------------------------------
+unsigned long R::readBlock(FeatureBlock& b, unsigned long maxCount,
+                           const ULongVector* pSelection) // private
+{
+  assert(_pReader != NULL || _pFeatureInputStream != NULL);
+  if (_seekWanted)
+  {
+    if (_historicUsage == LIMITED && !featureWantedIsInHistoric())
     {
-      unsigned long m = _pBuffer->size();
-      if (_bufferIsInternal)
+      if (maxCount > 1)
+        maxCount = 1;
+      if (pSelection != NULL)
+        return FeatureInputStream::readSelectedFeatures(b, maxCount,
+                                                        *pSelection);
+      return FeatureInputStream::readFeatures(b, maxCount);
+    }
+    _seekWanted = false;
+    _featureIndex = _seekWantedIdx;
+  }
+  const unsigned long vectSize = getVectSize();
+  b.setVectSize(pSelection != NULL ? pSelection->size() : vectSize);
+  b.setFeatureCount(0);
+  unsigned long featureCount = getFeatureCount();
+  if (_featureIndex >= featureCount || maxCount == 0)
+    return 0;
+  if (_featureIndex < _featureIndexOfBuffer ||
+      _featureIndex >= _featureIndexOfBuffer + _nbStored)
+    loadBuffer(featureCount, maxCount);
+  // copies the features available in the buffer
+  unsigned long n = _featureIndexOfBuffer + _nbStored - _featureIndex;
+  if (n > maxCount)
+    n = maxCount;
+  b.setFeatureCount(n);
+  const float* src = _pBuffer->getArray()
+                     + (_featureIndex-_featureIndexOfBuffer)*vectSize;
+  Feature::data_t* dst = b.getDataMatrix();
+  if (pSelection == NULL)
+  {
+    const unsigned long size = n*vectSize;
+    for (unsigned long i=0; i<size; i++)
+      dst[i] = src[i];
+  }
+  else
+  {
+    setSelectionRuns(*pSelection);
+    copySelectedData(src, dst, n);
+  }
+  const unsigned long labelCode = (_pLabelServer != NULL) ?
+                                  getSourceLabelCode() : 0;
+  for (unsigned long i=0; i<n; i++)
+  {
+    b.setValidity(i, true);
+    b.setLabelCode(i, labelCode);
+  }
+  Counters::add(Counters::FEATURES_READ, n);
+  _featureIndex += n;
+  if (_featureIndex > _lastFeatureIndex)
+    _lastFeatureIndex = _featureIndex;
+  _error = NO_ERROR;
+  return n;
+}
+//-------------------------------------------------------------------------
+void R::setSelectionRuns(const ULongVector& selection) // private
+{
+  if (selection.size() == _selection.size() && // runs already computed
+      memcmp(selection.getArray(), _selection.getArray(),
+             selection.size()*sizeof(unsigned long)) == 0)
+    return;
+  // the selection is cut into runs of consecutive components
+  // (first input component, first output component, length)
+  const unsigned long vectSize = getVectSize();
+  const unsigned long n = selection.size();
+  const unsigned long* s = selection.getArray();
+  _selection.clear();
+  _selectionRuns.clear();
+  _selectionSize = n;
+  for (unsigned long j=0; j<n; )
+  {
+    unsigned long length = 1;
+    while (j+length < n && s[j+length] == s[j]+length)
+      length++;
+    if (s[j]+length > vectSize)
+      throw Exception("A selected component is outside of the feature vector",
+                      __FILE__, __LINE__);
+    _selectionRuns.addValue(s[j]);
+    _selectionRuns.addValue(j);
+    _selectionRuns.addValue(length);
+    j += length;
+  }
+  _selection = selection;
+}
+//-------------------------------------------------------------------------
+void R::copySelectedData(const float* src, Feature::data_t* dst,
+                         unsigned long featureCount) // private
+{
+  const unsigned long vectSize = getVectSize();
+  const unsigned long runCount = _selectionRuns.size()/3;
+  const unsigned long* runs = _selectionRuns.getArray();
+  for (unsigned long i=0; i<featureCount; i++)
+  {
+    const float* in = src+i*vectSize;
+    Feature::data_t* out = dst+i*_selectionSize;
+    for (unsigned long r=0; r<runCount; r++)
+    {
+      const float* x = in+runs[3*r];
+      Feature::data_t* y = out+runs[3*r+1];
+      const unsigned long length = runs[3*r+2];
+      for (unsigned long k=0; k<length; k++)
+        y[k] = x[k];
+    }
+  }
+}
+//-------------------------------------------------------------------------
+void R::loadBuffer(unsigned long featureCount,
+                   unsigned long blockSize) // private
+{
+  Counters::Timer timer(Counters::FEATURE_BUFFER_LOAD_TIME);
+  Counters::add(Counters::FEATURE_BUFFER_LOADS, 1);
+  if (!_bufferSizeDefined)
+  {
+    unsigned long m = _pBuffer->size();
+    if (_bufferIsInternal)
+    {
+      if (_bufferUsage == BUFFER_USERDEFINE)
+        m = _userDefineBufferSize/sizeof(float);
+      else if (_bufferUsage == BUFFER_AUTO)
       {
-        if (_bufferUsage == BUFFER_USERDEFINE)
-          m = _userDefineBufferSize/sizeof(float);
-        else if (_bufferUsage == BUFFER_AUTO)
+        if (getConfig().existsParam_loadFeatureFileMemAlloc)
         {
-          if (getConfig().existsParam_loadFeatureFileMemAlloc)
-          {
-            m = getConfig().getParam_loadFeatureFileMemAlloc()/sizeof(float);
-            unsigned long n = featureCount*getVectSize();
-            if (n < m)
-              m = n;
-          }
+          m = getConfig().getParam_loadFeatureFileMemAlloc()/sizeof(float);
+          unsigned long n = featureCount*getVectSize();
+          if (n < m)
+            m = n;
         }
       }
-      if (m < getVectSize()) // minimum size
-        m = getVectSize();
-      _pBuffer->setSize(m);
-      _bufferSizeDefined = true;
     }
-    unsigned long start = _featureIndex;
-    if (featureCount-_featureIndex < _pBuffer->size()/getVectSize())
-    {
-      unsigned long x = _pBuffer->size()/getVectSize() -
-                        (featureCount-_featureIndex);
-      if (x < _featureIndex)
-        start -= x;
-      else
-        start = 0;
+    if (m < getVectSize()) // minimum size
+      m = getVectSize();
+    _pBuffer->setSize(m);
+    _bufferSizeDefined = true;
+  }
+  // without memory limit, the buffer grows up to the size of the blocks
+  // read by readFeatures()
+  if (_bufferIsInternal && _bufferUsage == BUFFER_AUTO &&
+      !getConfig().existsParam_loadFeatureFileMemAlloc)
+  {
+    if (blockSize > featureCount)
+      blockSize = featureCount;
+    if (_pBuffer->size() < blockSize*getVectSize())
+      _pBuffer->setSize(blockSize*getVectSize());
+  }
+  unsigned long start = _featureIndex;
+  if (featureCount-_featureIndex < _pBuffer->size()/getVectSize())
+  {
+    unsigned long x = _pBuffer->size()/getVectSize() -
+                      (featureCount-_featureIndex);
+    if (x < _featureIndex)
+      start -= x;
+    else
+      start = 0;
+  }
+  // si le bloc de donnees a charger ne suit pas le bloc deja en memoire
+  // on se repositionne dans le fichier
+  if (start != _featureIndexOfBuffer + _nbStored /*+ 1*/) {
+    if (_pReader != NULL) {
+      _pReader->seek(getHeaderLength() + start*getVectSize()*sizeof(float));
     }
-    // si le bloc de donnees a charger ne suit pas le bloc deja en memoire
-    // on se repositionne dans le fichier
-    if (start != _featureIndexOfBuffer + _nbStored /*+ 1*/) {
-      if (_pReader != NULL) {
-        _pReader->seek(getHeaderLength() + start*getVectSize()*sizeof(float));
-      }
-      else {
-        _pFeatureInputStream->seekFeature(start);
-      }
+    else {
+      _pFeatureInputStream->seekFeature(start);
     }
-    // chargement des donnees dans le buffer
-    if (_pReader != NULL)
-      _nbStored = _pReader->readSomeFloats(*_pBuffer)/getVectSize();
-    else
+  }
+  // chargement des donnees dans le buffer
+  if (_pReader != NULL)
+    _nbStored = _pReader->readSomeFloats(*_pBuffer)/getVectSize();
+  else
+  {
+    // Pas performant. A amliorer
+    _nbStored = 0;
+    unsigned long vectSize = _pFeatureInputStream->getVectSize();
+    while ((_nbStored+1)*vectSize <= _pBuffer->size()
+            && _pFeatureInputStream->readFeature(_f))
     {
-      // Pas performant. A amliorer
-      _nbStored = 0;
-      unsigned long vectSize = _pFeatureInputStream->getVectSize();
-      while ((_nbStored+1)*vectSize <= _pBuffer->size()
-              && _pFeatureInputStream->readFeature(_f))
-      {
-        unsigned long ii = _nbStored*vectSize;
-        for (unsigned long j=0; j<vectSize; j++)
-          (*_pBuffer)[ii+j] = (float) _f[j];
-        _nbStored++;
-      }
+      unsigned long ii = _nbStored*vectSize;
+      for (unsigned long j=0; j<vectSize; j++)
+        (*_pBuffer)[ii+j] = (float) _f[j];
+      _nbStored++;
     }
-
-    _featureIndexOfBuffer = start;
-    // if all the features are loaded in the buffer, we close the file
-    if (_nbStored == featureCount)
-      close();
-    else
-      // donnes pas toutes en mmoire -> interdit le writeFeature()
-      _featuresAreWritable = false;
   }
-  f.setVectSize(K::k, getVectSize());
-  f.setData(*_pBuffer, (_featureIndex-_featureIndexOfBuffer)*getVectSize());
-  f.setValidity(true);
 
-  _featureIndex += step;
-  if (_featureIndex > _lastFeatureIndex)
-    _lastFeatureIndex = _featureIndex;
-  if (_pLabelServer != NULL)
+  _featureIndexOfBuffer = start;
+  // if all the features are loaded in the buffer, we close the file
+  if (_nbStored == featureCount)
+    close();
+  else
+    // donnes pas toutes en mmoire -> interdit le writeFeature()
+    _featuresAreWritable = false;
+}
+//-------------------------------------------------------------------------
+unsigned long R::getSourceLabelCode() // private
+{
+  const String& srcName = (_pReader != NULL) ? _pReader->getFileName()
+      : _pFeatureInputStream->getNameOfASource(0); // TODO : not always 0 ?
+  // the label code of the source is cached and only checked against
+  // the server (which can have been cleared since the last frame)
+  if (_labelCode < 0 || (unsigned long)_labelCode >= _pLabelServer->size()
+      || _pLabelServer->getLabel(_labelCode).getSourceName() != srcName
+      || !_pLabelServer->getLabel(_labelCode).getString().isEmpty())
   {
     Label l;
-    if (_pReader != NULL)
-      l.setSourceName(_pReader->getFileName());
-    else
-      l.setSourceName(_pFeatureInputStream->getNameOfASource(0)); // TODO : not always 0 ?
-    f.setLabelCode(_pLabelServer->addLabel(l));
+    l.setSourceName(srcName);
+    _labelCode = _pLabelServer->addLabel(l);
   }
-  _error = NO_ERROR;
-  return true;
+  return _labelCode;
 }
 //-------------------------------------------------------------------------
 bool R::addFeature(const Feature& f) {
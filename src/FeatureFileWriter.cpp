@@ -58,6 +58,7 @@
 #include <new>
 #include "FeatureFileWriter.h"
 #include "Feature.h"
+#include "FeatureBlock.h"
 #include "Exception.h"
 #include "Config.h"
 
@@ -68,7 +69,11 @@ typedef FeatureFileWriter W;
 W::FeatureFileWriter(const FileName& f, const Config& c)
 :FileWriter(getFullFileName(c, f)),
  _format(c.getParam_saveFeatureFileFormat()), _vectSizeDefined(false),
- _headerWritten(false), _config(c) {}
+ _featureCount(0), _headerWritten(false), _config(c)
+{
+  _swap = c.existsParam_saveFeatureFileBigEndian
+          && c.getParam_saveFeatureFileBigEndian();
+}
 //-------------------------------------------------------------------------
 W& W::create(const FileName& f, const Config& c)
 {
@@ -85,94 +90,92 @@ String W::getFullFileName(const Config& c, const FileName& f) const
        + c.getParam_saveFeatureFileExtension();
 }
 //-------------------------------------------------------------------------
-void W::writeFeature(const Feature& f)
+void W::writeHeader(unsigned long vectSize) // private
 {
   if (!_vectSizeDefined)
   {
-    _vectSize = f.getVectSize();
+    _vectSize = vectSize;
     _vectSizeDefined = true;
   }
   else
-    if (f.getVectSize() != _vectSize)
+    if (vectSize != _vectSize)
       throw Exception("Incompatible vectSize", __FILE__, __LINE__);
 
   if (isClosed())
     open();
-
-  if (_format == FeatureFileWriterFormat_RAW) // **************************************************
+  if (_headerWritten)
+    return;
+  if (_format == FeatureFileWriterFormat_SPRO3) // ************************
   {
-    for (unsigned long i=0; i<_vectSize; i++)
-    {
-      writeFloat((float)f[i]);
-    }
+    const FeatureFlags flags = _config.getParam_featureFlags();
+    unsigned long dim = 0;
+    const String& s = flags.getString();
+    if (s == "100000")
+      dim = _vectSize;
+    else if (s == "110000")
+      dim = _vectSize-1;
+    else if (s == "101000")
+      dim = _vectSize/2;
+    else if (s == "111000" || s == "101100")
+      dim = (_vectSize-1)/2;
+    else if (s == "111100")
+      dim = (_vectSize-2)/2;
+    else if (s == "100010")
+      dim = _vectSize/2;
+    else if (s == "110010")
+      dim = (_vectSize-1)/2;
+    else if (s == "101010")
+      dim = _vectSize/3;
+    else if (s == "111010" || s == "101110")
+      dim = (_vectSize-1)/3;
+    else if (s == "111110")
+      dim = (_vectSize-2)/3;
+    else if (s == "100011")
+      dim = (_vectSize-1)/2;
+    else if (s == "110011")
+      dim = (_vectSize-2)/2;
+    else if (s == "101011")
+      dim = (_vectSize-1)/3;
+    else if (s == "111011" || s == "101111")
+      dim = (_vectSize-2)/3;
+    else if (s == "111111")
+      dim = (_vectSize-3)/3;
+    else
+      throw Exception("Wrong featureFlag : " + s,
+               __FILE__, __LINE__);
+    writeUInt4(_config.getParam_saveFeatureFileSPro3DataKind());
+    writeUInt4(dim);
+    writeUInt4(0);
+    writeUInt4(flags.toSPro3());
+    _headerWritten = true;
+    _featureCount = 0;
   }
-  else if (_format == FeatureFileWriterFormat_SPRO3) // *******************************************
+  else if (_format == FeatureFileWriterFormat_SPRO4) // *******************
   {
-    if (!_headerWritten)
-    {
-      const FeatureFlags flags = _config.getParam_featureFlags();
-      unsigned long dim = 0;
-      const String& s = flags.getString();
-      if (s == "100000")
-        dim = _vectSize;
-      else if (s == "110000")
-        dim = _vectSize-1;
-      else if (s == "101000")
-        dim = _vectSize/2;
-      else if (s == "111000" || s == "101100")
-        dim = (_vectSize-1)/2;
-      else if (s == "111100")
-        dim = (_vectSize-2)/2;
-      else if (s == "100010")
-        dim = _vectSize/2;
-      else if (s == "110010")
-        dim = (_vectSize-1)/2;
-      else if (s == "101010")
-        dim = _vectSize/3;
-      else if (s == "111010" || s == "101110")
-        dim = (_vectSize-1)/3;
-      else if (s == "111110")
-        dim = (_vectSize-2)/3;
-      else if (s == "100011")
-        dim = (_vectSize-1)/2;
-      else if (s == "110011")
-        dim = (_vectSize-2)/2;
-      else if (s == "101011")
-        dim = (_vectSize-1)/3;
-      else if (s == "111011" || s == "101111")
-        dim = (_vectSize-2)/3;
-      else if (s == "111111")
-        dim = (_vectSize-3)/3;
-      else
-        throw Exception("Wrong featureFlag : " + s,
-                 __FILE__, __LINE__);
-      writeUInt4(_config.getParam_saveFeatureFileSPro3DataKind());
-      writeUInt4(dim);
-      writeUInt4(0);
-      writeUInt4(flags.toSPro3());
-      _headerWritten = true;
-      _featureCount = 0;
-    }
-    for (unsigned long i=0; i<_vectSize; i++)
-    { writeFloat((float)f[i]); }
-    _featureCount++;
+    writeString("<header>\n");
+    writeString("</header>\n");
+    writeShort((short)_vectSize);
+    writeUInt4(_config.getParam_featureFlags().toSPro4());
+    writeFloat((float)_config.getParam_sampleRate());
+    _headerWritten = true;
   }
-  else if (_format == FeatureFileWriterFormat_SPRO4) // *******************************************
-  {
-    if (!_headerWritten)
-    {
-      writeString("<header>\n");
-      writeString("</header>\n");
-      writeShort((short)_vectSize);
-      writeUInt4(_config.getParam_featureFlags().toSPro4());
-      writeFloat((float)_config.getParam_sampleRate());
-      _headerWritten = true;
-    }
-    for (unsigned long i=0; i<_vectSize; i++)
-    { writeFloat((float)f[i]); }
-  }
-  else
-     ;
+}
+//-------------------------------------------------------------------------
+void W::writeFeature(const Feature& f)
+{
+  writeHeader(f.getVectSize());
+  writeFloats(f.getDataVector(), _vectSize);
+  _featureCount++;
+}
+//-------------------------------------------------------------------------
+void W::writeFeatures(const FeatureBlock& b)
+{
+  const unsigned long n = b.getFeatureCount();
+  if (n == 0)
+    return;
+  writeHeader(b.getVectSize());
+  writeFloats(b.getDataMatrix(), n*_vectSize);
+  _featureCount += n;
 }
 //-------------------------------------------------------------------------
 void W::close()
@@ -180,6 +183,7 @@ void W::close()
   if (_format == FeatureFileWriterFormat_SPRO3 && isOpen() && _headerWritten)
   {
      // update feature count just before closing the file
+    flush();
     if (::fseek(_pFileStruct, 4+4, SEEK_SET) != 0) // if error
       throw IOException("", __FILE__, __LINE__, _fileName);
     writeUInt4(_featureCount);
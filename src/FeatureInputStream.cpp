@@ -58,6 +58,8 @@
 #include "FeatureInputStream.h"
 #include "Exception.h"
 #include "Feature.h"
+#include "FeatureBlock.h"
+#include "ULongVector.h"
 #include "LabelServer.h"
 #include "Config.h"
 
@@ -66,12 +68,13 @@ typedef FeatureInputStream S;
 
 //-------------------------------------------------------------------------
 S::FeatureInputStream()
-:Object(), _pLabelServer(NULL), _pConfig(NULL) {}
+:Object(), _pLabelServer(NULL), _pConfig(NULL), _pFullFeature(NULL) {}
 //-------------------------------------------------------------------------
 S::FeatureInputStream(const Config& c, LabelServer* p)
 :Object(), _pLabelServer(p), _seekWanted(false),
  _featuresAreWritable(c.existsParam_featureServerMode &&
- c.getParam_featureServerMode() == "FEATURE_WRITABLE"), _pConfig(&c) {}
+ c.getParam_featureServerMode() == "FEATURE_WRITABLE"), _pConfig(&c),
+ _pFullFeature(NULL) {}
 //-------------------------------------------------------------------------
 void S::init(const Config& c, LabelServer* p)
 {
@@ -94,10 +97,50 @@ bool S::existsConfig() const { return _pConfig != NULL; }
 //-------------------------------------------------------------------------
 S::Error FeatureInputStream::getError() { return _error; }
 //-------------------------------------------------------------------------
+unsigned long S::readFeatures(FeatureBlock& b, unsigned long maxCount)
+{
+  Feature f;
+  unsigned long n = 0;
+  for (; n<maxCount && readFeature(f); n++)
+  {
+    if (n == 0)
+      b.setVectSize(f.getVectSize());
+    b.setFeatureCount(n+1);
+    b.setFeature(n, f);
+  }
+  b.setFeatureCount(n);
+  return n;
+}
+//-------------------------------------------------------------------------
+bool S::readSelectedFeature(Feature& f, const ULongVector& selection,
+                            unsigned long step)
+{
+  if (_pFullFeature == NULL)
+    _pFullFeature = &Feature::create(0);
+  if (!readFeature(*_pFullFeature, step))
+    return false;
+  f.setVectSize(K::k, selection.size());
+  f.copySelectedData(*_pFullFeature, selection);
+  return true;
+}
+//-------------------------------------------------------------------------
+unsigned long S::readSelectedFeatures(FeatureBlock& b,
+              unsigned long maxCount, const ULongVector& selection)
+{
+  const unsigned long n = readFeatures(b, maxCount);
+  if (n != 0)
+    b.selectComponents(selection);
+  return n;
+}
+//-------------------------------------------------------------------------
 bool FeatureInputStream::writeFeature(const Feature& f, unsigned long step)
 { throw Exception("Feature writing forbidden", __FILE__, __LINE__); }
 //-------------------------------------------------------------------------
-S::~FeatureInputStream() {}
+S::~FeatureInputStream()
+{
+  if (_pFullFeature != NULL)
+    delete _pFullFeature;
+}
 //-------------------------------------------------------------------------
 
 #endif // !defined(ALIZE_FeatureInputStream_cpp)
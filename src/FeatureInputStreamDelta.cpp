@@ -0,0 +1,352 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_FeatureInputStreamDelta_cpp)
+#define ALIZE_FeatureInputStreamDelta_cpp
+
+#include <new>
+#include <climits>
+#include "FeatureInputStreamDelta.h"
+#include "Exception.h"
+
+using namespace alize;
+typedef FeatureInputStreamDelta M;
+
+//-------------------------------------------------------------------------
+M::FeatureInputStreamDelta(FeatureInputStream& is, unsigned long window,
+                           bool useDD, bool ownStream)
+:FeatureInputStream(is.getConfig()), _pInput(&is), _window(window),
+ _useDD(useDD), _ownStream(ownStream), _inVectSize(0), _sBegin(0),
+ _sEnd(0), _dBegin(0), _dEnd(0), _winValid(false), _pos(0),
+ _inputIdx(ULONG_MAX), _srcFirst(0), _srcEnd(0)
+{
+  if (_window == 0)
+    throw Exception("Delta window cannot be 0", __FILE__, __LINE__);
+  double sum = 0.0;
+  for (unsigned long k=1; k<=_window; k++)
+    sum += (double)(k*k);
+  _norm = 1.0/(2.0*sum);
+  const unsigned long dw = _useDD ? _window : 0;
+  for (unsigned long i=0; i<2*_window+2*dw+1; i++)
+    _staticRing.addObject(Feature::create(0));
+}
+//-------------------------------------------------------------------------
+M& M::create(FeatureInputStream& is, unsigned long window, bool useDD,
+             bool ownStream)
+{
+  M* p = new (std::nothrow) M(is, window, useDD, ownStream);
+  assertMemoryIsAllocated(p, __FILE__, __LINE__);
+  return *p;
+}
+//-------------------------------------------------------------------------
+bool M::locateSource(unsigned long idx) // private
+{
+  if (idx >= _srcFirst && idx < _srcEnd)
+    return true;
+  unsigned long n = _pInput->getSourceCount();
+  for (unsigned long i=0; i<n; i++)
+  {
+    unsigned long first = _pInput->getFirstFeatureIndexOfASource(i);
+    unsigned long end = first + _pInput->getFeatureCountOfASource(i);
+    if (idx >= first && idx < end)
+    {
+      _srcFirst = first;
+      _srcEnd = end;
+      _winValid = false;
+      return true;
+    }
+  }
+  return false;
+}
+//-------------------------------------------------------------------------
+bool M::readInput(unsigned long idx, Feature& f) // private
+{
+  if (_inputIdx != idx)
+    _pInput->seekFeature(idx);
+  if (!_pInput->readFeature(f))
+  {
+    _inputIdx = ULONG_MAX;
+    _error = _pInput->getError();
+    return false;
+  }
+  _inputIdx = idx+1;
+  return true;
+}
+//-------------------------------------------------------------------------
+unsigned long M::clipBegin(unsigned long idx, unsigned long w) const
+{ return idx >= _srcFirst+w ? idx-w : _srcFirst; } // private
+//-------------------------------------------------------------------------
+unsigned long M::clipEnd(unsigned long idx, unsigned long w) const
+{ return idx+w+1 < _srcEnd ? idx+w+1 : _srcEnd; } // private
+//-------------------------------------------------------------------------
+Feature& M::staticFeature(unsigned long idx) // private
+{ return _staticRing.getObject(idx % _staticRing.size()); }
+//-------------------------------------------------------------------------
+double* M::deltaData(unsigned long idx) // private
+{
+  const unsigned long dw = _useDD ? _window : 0;
+  return _deltaRing.getArray() + (idx % (2*dw+1))*_inVectSize;
+}
+//-------------------------------------------------------------------------
+bool M::fillWindows() // private
+{
+  const unsigned long dw = _useDD ? _window : 0;
+  const unsigned long db = clipBegin(_pos, dw);   // deltas needed
+  const unsigned long de = clipEnd(_pos, dw);
+  const unsigned long sb = clipBegin(db, _window); // features needed
+  const unsigned long se = clipEnd(de-1, _window);
+  if (!_winValid || sb < _sBegin || sb >= _sEnd)
+  {
+    _sBegin = _sEnd = sb;
+    _dBegin = _dEnd = db;
+    _winValid = true;
+  }
+  _sBegin = sb;
+  for (; _sEnd<se; _sEnd++)
+    if (!readInput(_sEnd, staticFeature(_sEnd)))
+    {
+      _winValid = false;
+      return false;
+    }
+  if (_inVectSize != staticFeature(_pos).getVectSize())
+  {
+    _inVectSize = staticFeature(_pos).getVectSize();
+    _deltaRing.setSize((2*dw+1)*_inVectSize);
+    _dBegin = _dEnd = db;
+  }
+  if (db < _dBegin || db >= _dEnd)
+    _dBegin = _dEnd = db;
+  _dBegin = db;
+  for (; _dEnd<de; _dEnd++)
+    computeDelta(_dEnd, deltaData(_dEnd));
+  return true;
+}
+//-------------------------------------------------------------------------
+void M::computeDelta(unsigned long idx, double* out) // private
+{
+  const unsigned long n = _inVectSize;
+  unsigned long i;
+  for (i=0; i<n; i++)
+    out[i] = 0.0;
+  for (unsigned long k=1; k<=_window; k++)
+  {
+    const unsigned long ip = idx+k < _srcEnd ? idx+k : _srcEnd-1;
+    const unsigned long im = idx >= _srcFirst+k ? idx-k : _srcFirst;
+    const Feature::data_t* p = staticFeature(ip).getDataVector();
+    const Feature::data_t* m = staticFeature(im).getDataVector();
+    const double kk = (double)k;
+    for (i=0; i<n; i++)
+      out[i] += kk*(p[i]-m[i]);
+  }
+  for (i=0; i<n; i++)
+    out[i] *= _norm;
+}
+//-------------------------------------------------------------------------
+void M::computeDeltaDelta(unsigned long idx, Feature::data_t* out)
+{ // private
+  const unsigned long n = _inVectSize;
+  unsigned long i;
+  for (i=0; i<n; i++)
+    out[i] = 0.0;
+  for (unsigned long k=1; k<=_window; k++)
+  {
+    const unsigned long ip = idx+k < _srcEnd ? idx+k : _srcEnd-1;
+    const unsigned long im = idx >= _srcFirst+k ? idx-k : _srcFirst;
+    const double* p = deltaData(ip);
+    const double* m = deltaData(im);
+    const double kk = (double)k;
+    for (i=0; i<n; i++)
+      out[i] += kk*(p[i]-m[i]);
+  }
+  for (i=0; i<n; i++)
+    out[i] *= _norm;
+}
+//-------------------------------------------------------------------------
+void M::resolveSeek() // private
+{
+  if (_seekWanted)
+  {
+    _pos = _seekWantedIdx;
+    if (!_seekWantedSrcName.isEmpty())
+      _pos += _pInput->getFirstFeatureIndexOfASource(_seekWantedSrcName);
+    _seekWanted = false;
+  }
+}
+//-------------------------------------------------------------------------
+void M::computeOutput(Feature::data_t* out) // private
+{ // out = [x d dd] of the feature #_pos
+  const unsigned long n = _inVectSize;
+  const Feature::data_t* in = staticFeature(_pos).getDataVector();
+  const double* delta = deltaData(_pos);
+  unsigned long i;
+  for (i=0; i<n; i++)
+    out[i] = in[i];
+  for (i=0; i<n; i++)
+    out[n+i] = delta[i];
+  if (_useDD)
+    computeDeltaDelta(_pos, out+2*n);
+}
+//-------------------------------------------------------------------------
+bool M::readFeature(Feature& f, unsigned long step)
+{
+  resolveSeek();
+  _error = NO_ERROR;
+  if (!locateSource(_pos) || !fillWindows())
+    return false;
+  const Feature& s = staticFeature(_pos);
+  f.setVectSize(K::k, _useDD ? 3*_inVectSize : 2*_inVectSize);
+  f.setValidity(s.isValid());
+  f.setLabelCode(s.getLabelCode());
+  computeOutput(f.getDataVector());
+  _pos += step;
+  return true;
+}
+//-------------------------------------------------------------------------
+unsigned long M::readFeatures(FeatureBlock& b, unsigned long maxCount)
+{
+  resolveSeek();
+  _error = NO_ERROR;
+  b.setFeatureCount(0);
+  unsigned long n = 0;
+  for (; n<maxCount && locateSource(_pos) && fillWindows(); n++)
+  {
+    const Feature& s = staticFeature(_pos);
+    if (n == 0)
+      b.setVectSize(_useDD ? 3*_inVectSize : 2*_inVectSize);
+    b.setFeatureCount(n+1);
+    b.setValidity(n, s.isValid());
+    b.setLabelCode(n, s.getLabelCode());
+    computeOutput(b.getDataVector(n));
+    _pos++;
+  }
+  return n;
+}
+//-------------------------------------------------------------------------
+bool M::addFeature(const Feature& f)
+{ throw Exception("Feature adding forbidden", __FILE__, __LINE__); }
+//-------------------------------------------------------------------------
+unsigned long M::getFeatureCount() { return _pInput->getFeatureCount(); }
+//-------------------------------------------------------------------------
+unsigned long M::getVectSize()
+{ return _pInput->getVectSize()*(_useDD ? 3 : 2); }
+//-------------------------------------------------------------------------
+const FeatureFlags& M::getFeatureFlags() 
+{
+  _flags = _pInput->getFeatureFlags();
+  if (_flags.useD || _flags.useDE || _flags.useDD || _flags.useDDE)
+    throw Exception("Input features already contain deltas",
+                    __FILE__, __LINE__);
+  _flags.useD = true;
+  _flags.useDE = _flags.useE;
+  _flags.useDD = _useDD;
+  _flags.useDDE = _useDD && _flags.useE;
+  return _flags;
+}
+//-------------------------------------------------------------------------
+void M::seekFeature(unsigned long i, const String& s)
+{
+  _seekWanted = true;
+  _seekWantedIdx = i;
+  _seekWantedSrcName = s;
+}
+//-------------------------------------------------------------------------
+real_t M::getSampleRate() { return _pInput->getSampleRate(); }
+//-------------------------------------------------------------------------
+void M::reset()
+{
+  _pInput->reset();
+  _inputIdx = ULONG_MAX;
+  _seekWanted = false;
+  _pos = 0;
+}
+//-------------------------------------------------------------------------
+void M::close() { _pInput->close(); }
+//-------------------------------------------------------------------------
+unsigned long M::getSourceCount() {return _pInput->getSourceCount();}
+//-------------------------------------------------------------------------
+unsigned long M::getFeatureCountOfASource(unsigned long srcIdx)
+{ return _pInput->getFeatureCountOfASource(srcIdx); }
+//-------------------------------------------------------------------------
+unsigned long M::getFeatureCountOfASource(const String& f)
+{ return _pInput->getFeatureCountOfASource(f); }
+//-------------------------------------------------------------------------
+unsigned long M::getFirstFeatureIndexOfASource(unsigned long srcIdx)
+{ return _pInput->getFirstFeatureIndexOfASource(srcIdx); }
+//-------------------------------------------------------------------------
+unsigned long M::getFirstFeatureIndexOfASource(const String& srcName)
+{ return _pInput->getFirstFeatureIndexOfASource(srcName); }
+//-------------------------------------------------------------------------
+const String& M::getNameOfASource(unsigned long srcIdx)
+{ return _pInput->getNameOfASource(srcIdx); }
+//-------------------------------------------------------------------------
+String M::getClassName() const { return "FeatureInputStreamDelta"; }
+//-------------------------------------------------------------------------
+String M::toString() const
+{
+  return FeatureInputStream::toString()
+    + "\n  input stream = " + _pInput->getClassName()
+    + "[" + getAddress() + "]"
+    + "\n  window = " + String::valueOf(_window)
+    + (_useDD ? "\n  delta-delta = true" : "\n  delta-delta = false");
+}
+//-------------------------------------------------------------------------
+M::~FeatureInputStreamDelta()
+{
+  _staticRing.deleteAllObjects();
+  if (_ownStream)
+    delete _pInput;
+}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_FeatureInputStreamDelta_cpp)
@@ -160,18 +160,22 @@ void M::updateMask(const String& b, const String& e) // private
 //-------------------------------------------------------------------------
 bool M::readFeature(Feature& f, unsigned long step)
 {
-  bool ok;
-  if (!_useMask)
-    ok = _pInput->readFeature(f, step);
-  else if ( (ok = _pInput->readFeature(_feature, step)) )
-  {
-    f.setVectSize(K::k, _selectionSize);
-    f.copySelectedData(_feature, _selection);
-  }
+  // the selection is pushed down to the input stream
+  bool ok = _useMask ? _pInput->readSelectedFeature(f, _selection, step)
+                     : _pInput->readFeature(f, step);
   _error = _pInput->getError();
   return ok;
 }
 //-------------------------------------------------------------------------
+unsigned long M::readFeatures(FeatureBlock& b, unsigned long maxCount)
+{
+  unsigned long n = _useMask ?
+                    _pInput->readSelectedFeatures(b, maxCount, _selection) :
+                    _pInput->readFeatures(b, maxCount);
+  _error = _pInput->getError();
+  return n;
+}
+//-------------------------------------------------------------------------
 bool M::addFeature(const Feature& f)
 {
   bool ok;
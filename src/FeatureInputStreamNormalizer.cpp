@@ -0,0 +1,369 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_FeatureInputStreamNormalizer_cpp)
+#define ALIZE_FeatureInputStreamNormalizer_cpp
+
+#include <new>
+#include <cmath>
+#include <climits>
+#include "FeatureInputStreamNormalizer.h"
+#include "Exception.h"
+#include "FeatureFlags.h"
+
+using namespace alize;
+typedef FeatureInputStreamNormalizer M;
+
+//-------------------------------------------------------------------------
+M::FeatureInputStreamNormalizer(FeatureInputStream& is, bool useVariance,
+                                unsigned long window, bool ownStream)
+:FeatureInputStream(is.getConfig()), _pInput(&is),
+ _useVariance(useVariance), _window(window), _ownStream(ownStream),
+ _winBegin(0), _winEnd(0), _winValid(false), _pos(0),
+ _inputIdx(ULONG_MAX), _srcFirst(0), _srcEnd(0) {}
+//-------------------------------------------------------------------------
+M& M::create(FeatureInputStream& is, bool useVariance,
+             unsigned long window, bool ownStream)
+{
+  M* p = new (std::nothrow) M(is, useVariance, window, ownStream);
+  assertMemoryIsAllocated(p, __FILE__, __LINE__);
+  return *p;
+}
+//-------------------------------------------------------------------------
+bool M::locateSource(unsigned long idx) // private
+{
+  if (idx >= _srcFirst && idx < _srcEnd)
+    return true;
+  unsigned long n = _pInput->getSourceCount();
+  for (unsigned long i=0; i<n; i++)
+  {
+    unsigned long first = _pInput->getFirstFeatureIndexOfASource(i);
+    unsigned long end = first + _pInput->getFeatureCountOfASource(i);
+    if (idx >= first && idx < end)
+    {
+      _srcFirst = first;
+      _srcEnd = end;
+      _winValid = false;
+      return true;
+    }
+  }
+  return false;
+}
+//-------------------------------------------------------------------------
+bool M::readInput(unsigned long idx, Feature& f) // private
+{
+  if (_inputIdx != idx)
+    _pInput->seekFeature(idx);
+  const bool ok = _pInput->readFeature(f);
+  _error = _pInput->getError();
+  // a reader with a limited historic returns an invalid feature when it
+  // cannot seek back
+  if (ok && _error == NO_ERROR && !f.isValid())
+    _error = FEATURE_OUT_OF_HISTORY;
+  if (!ok || _error != NO_ERROR)
+  {
+    _inputIdx = ULONG_MAX;
+    return false;
+  }
+  _inputIdx = idx+1;
+  return true;
+}
+//-------------------------------------------------------------------------
+Feature& M::ringFeature(unsigned long idx) // private
+{ return _ring.getObject(idx % _ring.size()); }
+//-------------------------------------------------------------------------
+bool M::computeGlobalStat() // private
+{
+  _acc.reset();
+  for (unsigned long i=_srcFirst; i<_srcEnd; i++)
+  {
+    if (!readInput(i, _feature))
+      return false;
+    _acc.accumulate(_feature);
+  }
+  computeStat();
+  _winBegin = _srcFirst;
+  _winEnd = _srcEnd;
+  _winValid = true;
+  return true;
+}
+//-------------------------------------------------------------------------
+bool M::slideWindow() // private
+{
+  const unsigned long h = _window/2;
+  const unsigned long b = _pos >= _srcFirst+h ? _pos-h : _srcFirst;
+  const unsigned long e = _pos+h+1 < _srcEnd ? _pos+h+1 : _srcEnd;
+  if (_ring.isEmpty())
+    for (unsigned long i=0; i<2*h+1; i++)
+      _ring.addObject(Feature::create(0));
+  if (!_winValid || b < _winBegin || b >= _winEnd)
+  {
+    _acc.reset();
+    _winBegin = _winEnd = b;
+    _winValid = true;
+  }
+  for (; _winBegin<b; _winBegin++)
+    _acc.deaccumulate(ringFeature(_winBegin));
+  while (_winEnd > e) // backward seek near the beginning of the source
+    _acc.deaccumulate(ringFeature(--_winEnd));
+  for (; _winEnd<e; _winEnd++)
+  {
+    Feature& f = ringFeature(_winEnd);
+    if (!readInput(_winEnd, f))
+    {
+      _winValid = false;
+      return false;
+    }
+    _acc.accumulate(f);
+  }
+  computeStat();
+  return true;
+}
+//-------------------------------------------------------------------------
+void M::computeStat() // private
+{
+  const unsigned long vectSize = _acc.getVectSize();
+  const double invCount = 1.0/(double)_acc.getCount();
+  const double* accVect = _acc.getAccVect().getArray();
+  const double* xaccVect = _acc.getxAccVect().getArray();
+  _meanVect.setSize(vectSize);
+  _invStdVect.setSize(vectSize);
+  double* meanVect = _meanVect.getArray();
+  double* invStdVect = _invStdVect.getArray();
+  for (unsigned long i=0; i<vectSize; i++)
+    meanVect[i] = accVect[i]*invCount;
+  if (_useVariance)
+    for (unsigned long i=0; i<vectSize; i++)
+    {
+      const double cov = xaccVect[i]*invCount - meanVect[i]*meanVect[i];
+      invStdVect[i] = cov > EPS_LK ? 1.0/sqrt(cov) : 1.0;
+    }
+  else
+    for (unsigned long i=0; i<vectSize; i++)
+      invStdVect[i] = 1.0;
+}
+//-------------------------------------------------------------------------
+void M::normalize(Feature::data_t* data) // private
+{
+  const unsigned long vectSize = _meanVect.size();
+  const double* meanVect = _meanVect.getArray();
+  const double* invStdVect = _invStdVect.getArray();
+  for (unsigned long i=0; i<vectSize; i++)
+    data[i] = (data[i]-meanVect[i])*invStdVect[i];
+}
+//-------------------------------------------------------------------------
+void M::resolveSeek() // private
+{
+  if (_seekWanted)
+  {
+    _pos = _seekWantedIdx;
+    if (!_seekWantedSrcName.isEmpty())
+      _pos += _pInput->getFirstFeatureIndexOfASource(_seekWantedSrcName);
+    _seekWanted = false;
+  }
+}
+//-------------------------------------------------------------------------
+bool M::nextFeature(const Feature*& p) // private
+{ // p = feature #_pos (not normalized) and up to date statistics
+  if (!locateSource(_pos))
+    return false;
+  if (_window == 0)
+  {
+    if (!_winValid && !computeGlobalStat())
+      return false;
+    if (!readInput(_pos, _feature))
+      return false;
+    p = &_feature;
+  }
+  else
+  {
+    if (!slideWindow())
+      return false;
+    p = &ringFeature(_pos);
+  }
+  return true;
+}
+//-------------------------------------------------------------------------
+bool M::readFeature(Feature& f, unsigned long step)
+{
+  resolveSeek();
+  _error = NO_ERROR;
+  const Feature* p;
+  if (!nextFeature(p))
+    return false;
+  f.setVectSize(K::k, p->getVectSize());
+  f = *p;
+  normalize(f.getDataVector());
+  _pos += step;
+  return true;
+}
+//-------------------------------------------------------------------------
+unsigned long M::readFeatures(FeatureBlock& b, unsigned long maxCount)
+{
+  resolveSeek();
+  _error = NO_ERROR;
+  b.setFeatureCount(0);
+  if (maxCount == 0 || !locateSource(_pos))
+    return 0;
+  unsigned long n = 0;
+  if (_window == 0) // the block is read from the input then normalized
+  {
+    if (!_winValid && !computeGlobalStat())
+      return 0;
+    if (_inputIdx != _pos)
+      _pInput->seekFeature(_pos);
+    if (maxCount > _srcEnd-_pos) // statistics of one source only
+      maxCount = _srcEnd-_pos;
+    n = _pInput->readFeatures(b, maxCount);
+    _error = _pInput->getError();
+    for (unsigned long i=0; i<n && _error == NO_ERROR; i++)
+      if (!b.isValid(i))
+        _error = FEATURE_OUT_OF_HISTORY;
+    if (_error != NO_ERROR)
+    {
+      b.setFeatureCount(0);
+      _inputIdx = ULONG_MAX;
+      return 0;
+    }
+    _inputIdx = (n != 0) ? _pos+n : ULONG_MAX;
+    for (unsigned long i=0; i<n; i++)
+      normalize(b.getDataVector(i));
+    _pos += n;
+  }
+  else
+  {
+    const Feature* p;
+    for (; n<maxCount && nextFeature(p); n++)
+    {
+      if (n == 0)
+        b.setVectSize(p->getVectSize());
+      b.setFeatureCount(n+1);
+      b.setFeature(n, *p);
+      normalize(b.getDataVector(n));
+      _pos++;
+    }
+  }
+  return n;
+}
+//-------------------------------------------------------------------------
+bool M::addFeature(const Feature& f)
+{ throw Exception("Feature adding forbidden", __FILE__, __LINE__); }
+//-------------------------------------------------------------------------
+unsigned long M::getFeatureCount() { return _pInput->getFeatureCount(); }
+//-------------------------------------------------------------------------
+unsigned long M::getVectSize() { return _pInput->getVectSize(); }
+//-------------------------------------------------------------------------
+const FeatureFlags& M::getFeatureFlags() 
+{ return _pInput->getFeatureFlags(); }
+//-------------------------------------------------------------------------
+void M::seekFeature(unsigned long i, const String& s)
+{
+  _seekWanted = true;
+  _seekWantedIdx = i;
+  _seekWantedSrcName = s;
+}
+//-------------------------------------------------------------------------
+real_t M::getSampleRate() { return _pInput->getSampleRate(); }
+//-------------------------------------------------------------------------
+void M::reset()
+{
+  _pInput->reset();
+  _inputIdx = ULONG_MAX;
+  _seekWanted = false;
+  _pos = 0;
+}
+//-------------------------------------------------------------------------
+void M::close() { _pInput->close(); }
+//-------------------------------------------------------------------------
+unsigned long M::getSourceCount() {return _pInput->getSourceCount();}
+//-------------------------------------------------------------------------
+unsigned long M::getFeatureCountOfASource(unsigned long srcIdx)
+{ return _pInput->getFeatureCountOfASource(srcIdx); }
+//-------------------------------------------------------------------------
+unsigned long M::getFeatureCountOfASource(const String& f)
+{ return _pInput->getFeatureCountOfASource(f); }
+//-------------------------------------------------------------------------
+unsigned long M::getFirstFeatureIndexOfASource(unsigned long srcIdx)
+{ return _pInput->getFirstFeatureIndexOfASource(srcIdx); }
+//-------------------------------------------------------------------------
+unsigned long M::getFirstFeatureIndexOfASource(const String& srcName)
+{ return _pInput->getFirstFeatureIndexOfASource(srcName); }
+//-------------------------------------------------------------------------
+const String& M::getNameOfASource(unsigned long srcIdx)
+{ return _pInput->getNameOfASource(srcIdx); }
+//-------------------------------------------------------------------------
+String M::getClassName() const { return "FeatureInputStreamNormalizer"; }
+//-------------------------------------------------------------------------
+String M::toString() const
+{
+  String s = FeatureInputStream::toString()
+    + "\n  input stream = " + _pInput->getClassName()
+    + "[" + getAddress() + "]";
+  s += _useVariance ? "\n  mode = MEAN_VARIANCE" : "\n  mode = MEAN";
+  if (_window == 0)
+    s += "\n  window = whole source";
+  else
+    s += "\n  window = " + String::valueOf(_window);
+  return s;
+}
+//-------------------------------------------------------------------------
+M::~FeatureInputStreamNormalizer()
+{
+  _ring.deleteAllObjects();
+  if (_ownStream)
+    delete _pInput;
+}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_FeatureInputStreamNormalizer_cpp)
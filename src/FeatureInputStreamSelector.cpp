@@ -0,0 +1,337 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_FeatureInputStreamSelector_cpp)
+#define ALIZE_FeatureInputStreamSelector_cpp
+
+#include <new>
+#include <climits>
+#include "FeatureInputStreamSelector.h"
+#include "SegCluster.h"
+#include "Seg.h"
+#include "Exception.h"
+#include "FeatureFlags.h"
+
+using namespace alize;
+typedef FeatureInputStreamSelector M;
+
+//-------------------------------------------------------------------------
+M::FeatureInputStreamSelector(FeatureInputStream& is, unsigned long coef,
+                              real_t threshold, bool ownStream)
+:FeatureInputStream(is.getConfig()), _pInput(&is), _coef(coef),
+ _threshold(threshold), _ownStream(ownStream), _featureIdx(ULONG_MAX),
+ _scanIdx(0), _scanEnded(false), _inputIdx(ULONG_MAX), _pos(0),
+ _pSegCluster(NULL), _segLabelCode(0), _pLastSeg(NULL), _srcIdx(0),
+ _srcFirst(0), _srcEnd(0) {}
+//-------------------------------------------------------------------------
+M& M::create(FeatureInputStream& is, unsigned long coef, real_t threshold,
+             bool ownStream)
+{
+  M* p = new (std::nothrow) M(is, coef, threshold, ownStream);
+  assertMemoryIsAllocated(p, __FILE__, __LINE__);
+  return *p;
+}
+//-------------------------------------------------------------------------
+void M::setSegCluster(SegCluster& c, unsigned long lc)
+{
+  _pSegCluster = &c;
+  _segLabelCode = lc;
+  _pLastSeg = NULL;
+}
+//-------------------------------------------------------------------------
+bool M::scanNextFeature() // private
+{
+  if (_scanEnded)
+    return false;
+  if (_inputIdx != _scanIdx)
+    _pInput->seekFeature(_scanIdx);
+  _featureIdx = ULONG_MAX;
+  if (!_pInput->readFeature(_feature))
+  {
+    _inputIdx = ULONG_MAX;
+    _scanEnded = true;
+    return false;
+  }
+  _inputIdx = _scanIdx+1;
+  _featureIdx = _scanIdx;
+  if (_coef >= _feature.getVectSize())
+    throw Exception("Invalid selection coefficient "
+                    + String::valueOf(_coef), __FILE__, __LINE__);
+  if (_feature[_coef] >= _threshold)
+  {
+    _selected.addValue(_scanIdx);
+    if (_pSegCluster != NULL)
+      addToSegCluster(_scanIdx);
+  }
+  _scanIdx++;
+  return true;
+}
+//-------------------------------------------------------------------------
+void M::scanUntil(unsigned long inputIdx) // private
+{
+  while (_scanIdx < inputIdx && scanNextFeature()) {}
+}
+//-------------------------------------------------------------------------
+unsigned long M::countSelectedBefore(unsigned long inputIdx) const
+{ // private - binary search in the sorted input indices
+  unsigned long lo = 0, hi = _selected.size();
+  const unsigned long* p = _selected.getArray();
+  while (lo < hi)
+  {
+    unsigned long mid = (lo+hi)/2;
+    if (p[mid] < inputIdx)
+      lo = mid+1;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+//-------------------------------------------------------------------------
+void M::addToSegCluster(unsigned long inputIdx) // private
+{
+  // _srcIdx is the index of the source following the current one
+  while (inputIdx >= _srcEnd && _srcIdx < _pInput->getSourceCount())
+  {
+    _srcFirst = _pInput->getFirstFeatureIndexOfASource(_srcIdx);
+    _srcEnd = _srcFirst + _pInput->getFeatureCountOfASource(_srcIdx);
+    _srcIdx++;
+    _pLastSeg = NULL;
+  }
+  unsigned long b = inputIdx - _srcFirst;
+  if (_pLastSeg != NULL && _pLastSeg->begin()+_pLastSeg->length() == b)
+    _pLastSeg->setLength(_pLastSeg->length()+1);
+  else
+    _pLastSeg = &_pSegCluster->addNewSeg(b, 1, _segLabelCode, "",
+                                         _pInput->getNameOfASource(_srcIdx-1));
+}
+//-------------------------------------------------------------------------
+bool M::readFeature(Feature& f, unsigned long step)
+{
+  if (_seekWanted)
+  {
+    _pos = _seekWantedIdx;
+    if (!_seekWantedSrcName.isEmpty())
+      _pos += getFirstFeatureIndexOfASource(_seekWantedSrcName);
+    _seekWanted = false;
+  }
+  while (_pos >= _selected.size() && scanNextFeature()) {}
+  _error = _pInput->getError();
+  if (_pos >= _selected.size())
+    return false;
+  unsigned long idx = _selected[_pos];
+  if (_featureIdx != idx) // not read during the scan : read it again
+  {
+    if (_inputIdx != idx)
+      _pInput->seekFeature(idx);
+    _featureIdx = ULONG_MAX;
+    if (!_pInput->readFeature(_feature))
+    {
+      _inputIdx = ULONG_MAX;
+      _error = _pInput->getError();
+      return false;
+    }
+    _inputIdx = idx+1;
+    _featureIdx = idx;
+  }
+  f.setVectSize(K::k, _feature.getVectSize());
+  f = _feature;
+  _pos += step;
+  return true;
+}
+//-------------------------------------------------------------------------
+unsigned long M::readFeatures(FeatureBlock& b, unsigned long maxCount)
+{
+  if (_seekWanted)
+  {
+    _pos = _seekWantedIdx;
+    if (!_seekWantedSrcName.isEmpty())
+      _pos += getFirstFeatureIndexOfASource(_seekWantedSrcName);
+    _seekWanted = false;
+  }
+  // out of the scan front : features are read one by one
+  if (_pos != _selected.size() || maxCount == 0)
+    return FeatureInputStream::readFeatures(b, maxCount);
+  _error = NO_ERROR;
+  unsigned long n = 0;
+  while (n == 0 && !_scanEnded && _pos == _selected.size())
+  {
+    if (_inputIdx != _scanIdx)
+      _pInput->seekFeature(_scanIdx);
+    _featureIdx = ULONG_MAX;
+    const unsigned long m = _pInput->readFeatures(b, maxCount);
+    _error = _pInput->getError();
+    if (m == 0)
+    {
+      _inputIdx = ULONG_MAX;
+      _scanEnded = true;
+      break;
+    }
+    _inputIdx = _scanIdx+m;
+    const unsigned long vectSize = b.getVectSize();
+    if (_coef >= vectSize)
+      throw Exception("Invalid selection coefficient "
+                      + String::valueOf(_coef), __FILE__, __LINE__);
+    // the selected features are packed at the beginning of the block
+    for (unsigned long i=0; i<m; i++, _scanIdx++)
+    {
+      const Feature::data_t* in = b.getDataVector(i);
+      if (in[_coef] < _threshold)
+        continue;
+      _selected.addValue(_scanIdx);
+      if (_pSegCluster != NULL)
+        addToSegCluster(_scanIdx);
+      if (n != i)
+      {
+        Feature::data_t* out = b.getDataVector(n);
+        for (unsigned long j=0; j<vectSize; j++)
+          out[j] = in[j];
+        b.setValidity(n, b.isValid(i));
+        b.setLabelCode(n, b.getLabelCode(i));
+      }
+      n++;
+    }
+  }
+  b.setFeatureCount(n);
+  _pos += n;
+  return n;
+}
+//-------------------------------------------------------------------------
+bool M::addFeature(const Feature& f)
+{ throw Exception("Feature adding forbidden", __FILE__, __LINE__); }
+//-------------------------------------------------------------------------
+unsigned long M::getFeatureCount()
+{
+  while (scanNextFeature()) {}
+  return _selected.size();
+}
+//-------------------------------------------------------------------------
+unsigned long M::getVectSize() { return _pInput->getVectSize(); }
+//-------------------------------------------------------------------------
+const FeatureFlags& M::getFeatureFlags() 
+{ return _pInput->getFeatureFlags(); }
+//-------------------------------------------------------------------------
+void M::seekFeature(unsigned long i, const String& s)
+{
+  _seekWanted = true;
+  _seekWantedIdx = i;
+  _seekWantedSrcName = s;
+}
+//-------------------------------------------------------------------------
+real_t M::getSampleRate() { return _pInput->getSampleRate(); }
+//-------------------------------------------------------------------------
+void M::reset()
+{
+  _pInput->reset();
+  _inputIdx = ULONG_MAX;
+  _seekWanted = false;
+  _pos = 0;
+}
+//-------------------------------------------------------------------------
+void M::close() { _pInput->close(); }
+//-------------------------------------------------------------------------
+unsigned long M::getSourceCount() {return _pInput->getSourceCount();}
+//-------------------------------------------------------------------------
+unsigned long M::getFeatureCountOfASource(unsigned long srcIdx)
+{
+  unsigned long b = _pInput->getFirstFeatureIndexOfASource(srcIdx);
+  unsigned long e = b + _pInput->getFeatureCountOfASource(srcIdx);
+  scanUntil(e);
+  return countSelectedBefore(e) - countSelectedBefore(b);
+}
+//-------------------------------------------------------------------------
+unsigned long M::getFeatureCountOfASource(const String& s)
+{ return getFeatureCountOfASource(findSource(s)); }
+//-------------------------------------------------------------------------
+unsigned long M::getFirstFeatureIndexOfASource(unsigned long srcIdx)
+{
+  unsigned long b = _pInput->getFirstFeatureIndexOfASource(srcIdx);
+  scanUntil(b);
+  return countSelectedBefore(b);
+}
+//-------------------------------------------------------------------------
+unsigned long M::getFirstFeatureIndexOfASource(const String& s)
+{ return getFirstFeatureIndexOfASource(findSource(s)); }
+//-------------------------------------------------------------------------
+unsigned long M::findSource(const String& s) // private
+{
+  unsigned long n = _pInput->getSourceCount();
+  for (unsigned long i=0; i<n; i++)
+    if (_pInput->getNameOfASource(i) == s)
+      return i;
+  throw Exception("Unknown source '" + s + "'", __FILE__, __LINE__);
+  return 0; // never called
+}
+//-------------------------------------------------------------------------
+const String& M::getNameOfASource(unsigned long srcIdx)
+{ return _pInput->getNameOfASource(srcIdx); }
+//-------------------------------------------------------------------------
+String M::getClassName() const { return "FeatureInputStreamSelector"; }
+//-------------------------------------------------------------------------
+String M::toString() const
+{
+  return FeatureInputStream::toString()
+    + "\n  input stream = " + _pInput->getClassName()
+    + "[" + getAddress() + "]"
+    + "\n  coef = " + String::valueOf(_coef)
+    + "\n  threshold = " + String::valueOf(_threshold);
+}
+//-------------------------------------------------------------------------
+M::~FeatureInputStreamSelector()
+{
+  if (_ownStream)
+    delete _pInput;
+}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_FeatureInputStreamSelector_cpp)
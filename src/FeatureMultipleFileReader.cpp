@@ -58,6 +58,7 @@
 #include <new>
 #include "FeatureMultipleFileReader.h"
 #include "Feature.h"
+#include "FeatureBlock.h"
 #include "Exception.h"
 #include "FeatureFlags.h"
 #include "LabelServer.h"
@@ -107,7 +108,76 @@ R& R::create(const XLine& list, const Config& c,
   return *p;
 }
 //-------------------------------------------------------------------------
-bool R::readFeature(Feature& f, unsigned long s) { return rw(true, f, s); }
+bool R::readFeature(Feature& f, unsigned long s)
+{ return rw(true, f, s, NULL); }
+//-------------------------------------------------------------------------
+bool R::readSelectedFeature(Feature& f, const ULongVector& selection,
+                            unsigned long s)
+{ return rw(true, f, s, &selection); }
+//-------------------------------------------------------------------------
+unsigned long R::readFeatures(FeatureBlock& b, unsigned long maxCount)
+{ return readBlock(b, maxCount, NULL); }
+//-------------------------------------------------------------------------
+unsigned long R::readSelectedFeatures(FeatureBlock& b,
+              unsigned long maxCount, const ULongVector& selection)
+{ return readBlock(b, maxCount, &selection); }
+//-------------------------------------------------------------------------
+unsigned long R::readBlock(FeatureBlock& b, unsigned long maxCount,
+                           const ULongVector* pSelection) // private
+{
+  // the historic has to be checked for each feature
+  if (_seekWanted && _historicUsage == LIMITED)
+  {
+    if (pSelection != NULL)
+      return FeatureInputStream::readSelectedFeatures(b, maxCount,
+                                                      *pSelection);
+    return FeatureInputStream::readFeatures(b, maxCount);
+  }
+  unsigned long featureNbr = 0;
+  unsigned long firstFeatureIndex = _lastFeatureIndex+1;
+  bool seekWantedInCurrentFile = _seekWanted;
+  if (_seekWanted)
+  {
+    _seekWanted = false;
+    if (_fileCount == 0)
+      _fileCounter = 0;
+    else if (_seekWantedSrcName.isEmpty())
+    {
+      _fileCounter = _fileList.getFileIndex(_seekWantedIdx);
+      featureNbr = _seekWantedIdx
+                   - _fileList.getIndexOfFirstFeature(_fileCounter);
+      firstFeatureIndex = _seekWantedIdx;
+    }
+    else
+    {
+      _fileCounter = _fileList.getFileIndex(_seekWantedSrcName);
+      featureNbr = _seekWantedIdx;
+      firstFeatureIndex = _fileList.getIndexOfFirstFeature(_fileCounter)
+                          + _seekWantedIdx;
+    }
+  }
+  // a block never spans two files
+  for (; _fileCounter < _fileCount; _fileCounter++)
+  {
+    FeatureFileReader& r = getReader(_fileCounter);
+    if (seekWantedInCurrentFile)
+      r.seekFeature(featureNbr);
+    unsigned long n = (pSelection != NULL) ?
+                      r.readSelectedFeatures(b, maxCount, *pSelection) :
+                      r.readFeatures(b, maxCount);
+    _error = r.getError();
+    if (n != 0)
+    {
+      if (firstFeatureIndex+n-1 > _lastFeatureIndex)
+        _lastFeatureIndex = firstFeatureIndex+n-1;
+      return n;
+    }
+    featureNbr = 0;
+    seekWantedInCurrentFile = true;
+  }
+  b.setFeatureCount(0);
+  return 0;
+}
 //-------------------------------------------------------------------------
 bool R::addFeature(const Feature& f) { throw Exception ("featureMultipleFileReader::addFeature not yet implemented", __FILE__, __LINE__); }
 //-------------------------------------------------------------------------
@@ -132,10 +202,11 @@ bool R::writeFeature(const Feature& f, unsigned long step)
   if (!_featuresAreWritable)
     throw Exception("Feature writing forbidden", __FILE__, __LINE__);
 
-  return rw(false, const_cast<Feature&>(f), step);
+  return rw(false, const_cast<Feature&>(f), step, NULL);
 }
 //-------------------------------------------------------------------------
-bool R::rw(bool read, Feature& f, unsigned long s) // private
+bool R::rw(bool read, Feature& f, unsigned long s,
+           const ULongVector* pSelection) // private
 {
   // _fileCounter = n du PROCHAIN fichier  lire
   unsigned long featureNbr = 0;
@@ -171,7 +242,8 @@ bool R::rw(bool read, Feature& f, unsigned long s) // private
       {
         if (!read) // if write
           throw Exception("Feature out of historic", __FILE__, __LINE__);
-        f.setVectSize(K::k, getVectSize());
+        f.setVectSize(K::k, (pSelection != NULL) ? pSelection->size()
+                                                 : getVectSize());
         f.setValidity(false);
         _error = FEATURE_OUT_OF_HISTORY;
         return true;
@@ -196,10 +268,12 @@ bool R::rw(bool read, Feature& f, unsigned long s) // private
       seekWantedInCurrentFile = false;
     }
     bool ok;
-    if (read)
-      ok = r.readFeature(f, s);
-    else
+    if (!read)
       ok = r.writeFeature(f, s);
+    else if (pSelection != NULL)
+      ok = r.readSelectedFeature(f, *pSelection, s);
+    else
+      ok = r.readFeature(f, s);
     _error = r.getError();
     if (ok)
     {
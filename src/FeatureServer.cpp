@@ -61,6 +61,9 @@
 #include "alizeString.h"
 #include "FeatureFileReader.h"
 #include "FeatureInputStreamModifier.h"
+#include "FeatureInputStreamDelta.h"
+#include "FeatureInputStreamSelector.h"
+#include "FeatureInputStreamNormalizer.h"
 #include "Config.h"
 #include "XLine.h"
 
@@ -151,6 +154,39 @@ void S::init(const Config& c, const XLine& l)
 void S::init() // private
 {
   const Config& config = this->getConfig();
+  if (config.existsParam_featureServerDeltaWindow)
+    if (_pInputStream != NULL)
+    {
+      bool useDD = true;
+      if (config.existsParam_featureServerDeltaDelta)
+        useDD = config.getParam_featureServerDeltaDelta();
+      _pInputStream = &FeatureInputStreamDelta::create(inputStream(),
+                  config.getParam_featureServerDeltaWindow(), useDD,
+                  _ownInputStream);
+      _ownInputStream = true;
+    }
+  if (config.existsParam_featureServerSelectionThreshold)
+    if (_pInputStream != NULL)
+    {
+      unsigned long coef = 0;
+      if (config.existsParam_featureServerSelectionCoef)
+        coef = config.getParam_featureServerSelectionCoef();
+      _pInputStream = &FeatureInputStreamSelector::create(inputStream(),
+                  coef, config.getParam_featureServerSelectionThreshold(),
+                  _ownInputStream);
+      _ownInputStream = true;
+    }
+  if (config.existsParam_featureServerNormalization)
+    if (_pInputStream != NULL)
+    {
+      unsigned long window = 0;
+      if (config.existsParam_featureServerNormalizationWindow)
+        window = config.getParam_featureServerNormalizationWindow();
+      _pInputStream = &FeatureInputStreamNormalizer::create(inputStream(),
+          config.getParam_featureServerNormalization() == "MEAN_VARIANCE",
+          window, _ownInputStream);
+      _ownInputStream = true;
+    }
   if (config.existsParam_featureServerMask)
     if (_pInputStream != NULL)
     {
@@ -252,6 +288,15 @@ bool S::readFeature(Feature& f, unsigned long step)
   return ok;
 }
 //-------------------------------------------------------------------------
+unsigned long S::readFeatures(FeatureBlock& b, unsigned long maxCount)
+{
+  if (_pInputStream == NULL)
+    return 0;
+  unsigned long n = inputStream().readFeatures(b, maxCount);
+  _error = inputStream().getError();
+  return n;
+}
+//-------------------------------------------------------------------------
 bool S::addFeature(const Feature& f)
 {
   if (_pInputStream == NULL)
@@ -61,6 +61,8 @@
 
 #include <new>
 #include "FileReader.h"
+#include "ByteSwap.h"
+#include "Counters.h"
 #include "Exception.h"
 #include "RealVector.h"
 //#include <iostream>
@@ -151,6 +153,7 @@ void R::seek(unsigned long pos) // protected
   if (::fseek(_pFileStruct, pos, SEEK_SET) != 0 )
     throw IOException("seek out of bounds",
           __FILE__, __LINE__, _fullFileName);
+  Counters::add(Counters::FILE_SEEKS, 1);
 }
 //-------------------------------------------------------------------------
 void R::read(void* buffer, unsigned long length) // private
@@ -159,7 +162,10 @@ void R::read(void* buffer, unsigned long length) // private
   if (isClosed())
     open(); // can throw Exception if file name = ""
   if (::fread(buffer, 1, length, _pFileStruct) == length)
+  {
+    Counters::add(Counters::FILE_BYTES_READ, length);
     return;
+  }
 
   // if end of file
   if (feof(_pFileStruct))
@@ -237,6 +243,17 @@ unsigned long R::readUInt4()
   return 0;
 }
 //-------------------------------------------------------------------------
+void R::readByteOrderCheck()
+{
+  _swap = false;
+  const unsigned long v = readUInt4();
+  if (v == 0x04030201) // written with the other byte order
+    _swap = true;
+  else if (v != 0x01020304)
+    throw InvalidDataException("Wrong byte order check word",
+                               __FILE__, __LINE__, _fullFileName);
+}
+//-------------------------------------------------------------------------
 double R::readDouble()
 {
   double s;
@@ -248,16 +265,9 @@ double R::readDouble()
 //-------------------------------------------------------------------------
 FloatVector& R::readFloats(FloatVector& v)
 {
+  read(v.getArray(), v.size()*4);
   if (_swap)
-  {
-    float* array = v.getArray();
-    unsigned long n = v.size();
-    read(array, n*4);
-    for (unsigned long i=0; i<n; i++)
-      swap4Bytes(&array[i]);
-  }
-  else
-    read(v.getArray(), v.size()*4);
+    ByteSwap::swap4(v.getArray(), v.size());
   return v;
 }
 //-------------------------------------------------------------------------
@@ -271,17 +281,21 @@ unsigned long R::readSomeFloats(FloatVector& v)
     open(); // can throw Exception if file name = ""
   float* array = v.getArray();
   unsigned long n = (unsigned long)(::fread(array, 4, v.size(), _pFileStruct));
+  Counters::add(Counters::FILE_BYTES_READ, n*4);
   if (_swap)
-  {
-    char* p = (char*)array;
-    char t;
-    for (unsigned long i=0; i<n; i++)
-    {
-      t = p[3]; p[3] = p[0]; p[0] = t;
-      t = p[2]; p[2] = p[1]; p[1] = t;
-      p += 4;
-    }
-  }
+    ByteSwap::swap4(array, n);
+  return n;
+}
+//-------------------------------------------------------------------------
+unsigned long R::readSomeBytes(void* buffer, unsigned long length)
+{
+  assert(buffer != NULL);
+  if (isClosed())
+    open(); // can throw Exception if file name = ""
+  unsigned long n = (unsigned long)(::fread(buffer, 1, length, _pFileStruct));
+  if (n != length && ferror(_pFileStruct))
+    throw IOException("Cannot read file", __FILE__, __LINE__, _fullFileName);
+  Counters::add(Counters::FILE_BYTES_READ, n);
   return n;
 }
 //-------------------------------------------------------------------------
@@ -406,7 +420,7 @@ void R::swap8Bytes(void *src, void *dest)
   for (i=0; i<4; i++)
   {
     tmp = p1[i]; /* pour pouvoir utiliser src == dest */
-    p1[i] = p2[7-i];
+    p2[i] = p1[7-i];
     p2[7-i] = tmp;
   }
 }
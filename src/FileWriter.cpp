@@ -59,14 +59,24 @@
 #define _CRT_SECURE_NO_WARNINGS
 #endif
 
+#include <new>
+#include <cstring>
 #include "FileWriter.h"
+#include "ByteSwap.h"
 #include "Exception.h"
 
 using namespace alize;
 
+static const unsigned long BUFFER_SIZE = 65536; // bytes
+
 //-------------------------------------------------------------------------
 FileWriter::FileWriter(const FileName& f)
-:Object(), _pFileStruct(NULL) , _fileName(f), _swap(false){}
+:Object(), _pFileStruct(NULL) , _fileName(f), _swap(false), _pBuffer(NULL),
+ _bufferSize(0)
+{
+  _pBuffer = new (std::nothrow) char[BUFFER_SIZE];
+  assertMemoryIsAllocated(_pBuffer, __FILE__, __LINE__);
+}
 //-------------------------------------------------------------------------
 bool FileWriter::isClosed() const { return _pFileStruct == NULL; }
 //-------------------------------------------------------------------------
@@ -87,71 +97,166 @@ void FileWriter::open()
 void FileWriter::close()
 {
   if (isOpen())
+  {
+    try { flush(); }
+    catch (Exception&)
+    {
+      ::fclose(_pFileStruct);
+      _pFileStruct = NULL;
+      throw;
+    }
     if (::fclose(_pFileStruct) == EOF)
+    {
+      _pFileStruct = NULL;
       throw IOException("Cannot close file", __FILE__, __LINE__,
                  _fileName);
+    }
+  }
   _pFileStruct = NULL;
 }
 //-------------------------------------------------------------------------
-void FileWriter::writeUInt4(unsigned long v)
+void FileWriter::flush()
 {
   assert(_pFileStruct != NULL);
-  if (sizeof(unsigned int) == 4)
+  const unsigned long n = _bufferSize;
+  _bufferSize = 0;
+  if (n != 0 && ::fwrite(_pBuffer, 1, n, _pFileStruct) != n)
+    throw IOException("Cannot write in file", __FILE__, __LINE__,
+               _fileName);
+}
+//-------------------------------------------------------------------------
+void FileWriter::write(const void* p, unsigned long length) // private
+{
+  assert(_pFileStruct != NULL);
+  if (_bufferSize+length > BUFFER_SIZE)
+    flush();
+  if (length >= BUFFER_SIZE) // written directly
   {
-    if (::fwrite(&v, sizeof(unsigned int), 1, _pFileStruct) != 1)
+    if (::fwrite(p, 1, length, _pFileStruct) != length)
       throw IOException("Cannot write in file", __FILE__, __LINE__,
                  _fileName);
   }
-  else if (sizeof(unsigned long) == 4)
+  else
   {
-    if (::fwrite(&v, sizeof(v), 1, _pFileStruct) != 1)
-      throw IOException("Cannot write in file", __FILE__, __LINE__,
-                _fileName);
+    memcpy(_pBuffer+_bufferSize, p, length);
+    _bufferSize += length;
   }
-  else
-    return; // TODO : what to do ?
 }
 //-------------------------------------------------------------------------
-void FileWriter::writeDouble(double v)
+void FileWriter::writeValue(const void* p, unsigned long size) // private
 {
   assert(_pFileStruct != NULL);
-  if (::fwrite(&v, sizeof(v), 1, _pFileStruct) != 1)
-    throw IOException("Cannot write in file", __FILE__, __LINE__,
-               _fileName);
+  if (_bufferSize+size > BUFFER_SIZE)
+    flush();
+  char* q = _pBuffer+_bufferSize;
+  memcpy(q, p, size);
+  if (_swap)
+  {
+    if (size == 2)
+      ByteSwap::swap2(q, 1);
+    else if (size == 4)
+      ByteSwap::swap4(q, 1);
+    else if (size == 8)
+      ByteSwap::swap8(q, 1);
+  }
+  _bufferSize += size;
 }
 //-------------------------------------------------------------------------
-void FileWriter::writeFloat(float v)
-{
+unsigned long FileWriter::getBufferSpace(unsigned long itemSize,
+                                         unsigned long n) // private
+{ // number of items (at most n) which can be appended to the buffer
   assert(_pFileStruct != NULL);
-  if (::fwrite(&v, sizeof(v), 1, _pFileStruct) != 1)
-    throw IOException("Cannot write in file", __FILE__, __LINE__,
-               _fileName);
+  if (_bufferSize+itemSize > BUFFER_SIZE)
+    flush();
+  const unsigned long m = (BUFFER_SIZE-_bufferSize)/itemSize;
+  return m < n ? m : n;
 }
 //-------------------------------------------------------------------------
-void FileWriter::writeShort(short v)
+void FileWriter::writeByteOrderCheck() { writeUInt4(0x01020304); }
+//-------------------------------------------------------------------------
+void FileWriter::writeUInt4(unsigned long v)
 {
-  assert(_pFileStruct != NULL);
-  if (::fwrite(&v, sizeof(v), 1, _pFileStruct) != 1)
-    throw IOException("Cannot write in file", __FILE__, __LINE__,
-               _fileName);
+  if (sizeof(unsigned int) == 4)
+  {
+    const unsigned int u = (unsigned int)v;
+    writeValue(&u, 4);
+  }
+  else if (sizeof(unsigned long) == 4)
+    writeValue(&v, 4);
+  else
+    return; // TODO : what to do ?
 }
 //-------------------------------------------------------------------------
-void FileWriter::writeChar(char v)
+void FileWriter::writeDouble(double v) { writeValue(&v, sizeof(v)); }
+//-------------------------------------------------------------------------
+void FileWriter::writeFloat(float v) { writeValue(&v, sizeof(v)); }
+//-------------------------------------------------------------------------
+void FileWriter::writeShort(short v) { writeValue(&v, sizeof(v)); }
+//-------------------------------------------------------------------------
+void FileWriter::writeChar(char v) { writeValue(&v, sizeof(v)); }
+//-------------------------------------------------------------------------
+void FileWriter::writeDoubles(const double* array, unsigned long n)
 {
-  assert(_pFileStruct != NULL);
-  if (::fwrite(&v, sizeof(v), 1, _pFileStruct) != 1)
-    throw IOException("Cannot write in file", __FILE__, __LINE__,
-               _fileName);
+  if (!_swap)
+  {
+    write(array, n*sizeof(double));
+    return;
+  }
+  while (n != 0)
+  {
+    const unsigned long m = getBufferSpace(8, n);
+    char* p = _pBuffer+_bufferSize;
+    memcpy(p, array, m*8);
+    ByteSwap::swap8(p, m);
+    _bufferSize += m*8;
+    array += m;
+    n -= m;
+  }
+}
+//-------------------------------------------------------------------------
+void FileWriter::writeFloats(const float* array, unsigned long n)
+{
+  if (!_swap)
+  {
+    write(array, n*sizeof(float));
+    return;
+  }
+  while (n != 0)
+  {
+    const unsigned long m = getBufferSpace(4, n);
+    char* p = _pBuffer+_bufferSize;
+    memcpy(p, array, m*4);
+    ByteSwap::swap4(p, m);
+    _bufferSize += m*4;
+    array += m;
+    n -= m;
+  }
+}
+//-------------------------------------------------------------------------
+void FileWriter::writeFloats(const double* array, unsigned long n)
+{
+  while (n != 0)
+  {
+    const unsigned long m = getBufferSpace(4, n);
+    char* p = _pBuffer+_bufferSize;
+    for (unsigned long i=0; i<m; i++)
+    {
+      const float f = (float)array[i];
+      memcpy(p+4*i, &f, 4);
+    }
+    if (_swap)
+      ByteSwap::swap4(p, m);
+    _bufferSize += m*4;
+    array += m;
+    n -= m;
+  }
 }
 //-------------------------------------------------------------------------
 void FileWriter::writeString(const String& string)
 {
   if (string.isEmpty())
     return;
-  assert(_pFileStruct != NULL);
-  if (::fwrite(string.c_str(), string.length(), 1, _pFileStruct) != 1)
-    throw IOException("Cannot write in file", __FILE__, __LINE__,
-               _fileName);
+  write(string.c_str(), string.length());
 }
 //-------------------------------------------------------------------------
 void FileWriter::writeAttribute(const String& name, const String& value)
@@ -210,14 +315,18 @@ void FileWriter::swap8Bytes(void *src, void *dest)
   for (i=0; i<4; i++)
   {
     tmp = p1[i]; /* pour pouvoir utiliser src == dest */
-    p1[i] = p2[7-i];
+    p2[i] = p1[7-i];
     p2[7-i] = tmp;
   }
 }
 //-------------------------------------------------------------------------
 String FileWriter::getClassName() const { return "FileWriter"; }
 //-------------------------------------------------------------------------
-FileWriter::~FileWriter() { close(); }
+FileWriter::~FileWriter()
+{
+  close();
+  delete [] _pBuffer;
+}
 //-------------------------------------------------------------------------
 
 #endif // !defined(ALIZE_FileWriter_cpp)
@@ -137,11 +137,13 @@ void A::accumulate(const Feature& f)
           + String::valueOf(vectSize) + "/"
           + String::valueOf(_vectSize) + ")", __FILE__, __LINE__);
   const double* dataVect = f.getDataVector();
+  double* accVect = _accVect.getArray();
+  double* xaccVect = _xaccVect.getArray();
   for (unsigned long i=0; i<_vectSize; i++)
   {
     const double v = dataVect[i];
-    _accVect[i] += v;
-    _xaccVect[i] += v*v;
+    accVect[i] += v;
+    xaccVect[i] += v*v;
   }
   _count++;
   _computed = false;
@@ -165,13 +167,14 @@ void A::add(const FrameAccGD& f)
           + String::valueOf(vectSize) + "/"
           + String::valueOf(_vectSize) + ")", __FILE__, __LINE__);
 
-  const DoubleVector& accVect =  f.getAccVect();
-  const DoubleVector& xAccVect = f.getxAccVect();
-
+  const double* accVect = f.getAccVect().getArray();
+  const double* xAccVect = f.getxAccVect().getArray();
+  double* thisAccVect = _accVect.getArray();
+  double* thisXAccVect = _xaccVect.getArray();
   for(unsigned long i = 0; i<_vectSize; i++)
   {
-    _accVect[i] += accVect[i];
-    _xaccVect[i] += xAccVect[i];
+    thisAccVect[i] += accVect[i];
+    thisXAccVect[i] += xAccVect[i];
   }
   _count += f.getCount();
   _computed = false;
@@ -191,12 +194,13 @@ void A::deaccumulate(const Feature& f)
           + String::valueOf(_vectSize) + ")", __FILE__, __LINE__);
 
   const double* dataVect = f.getDataVector();
-
+  double* accVect = _accVect.getArray();
+  double* xaccVect = _xaccVect.getArray();
   for (unsigned long i=0; i<_vectSize; i++)
   {
     const double v = dataVect[i];
-    _accVect[i] -= v;
-    _xaccVect[i] -= v*v;
+    accVect[i] -= v;
+    xaccVect[i] -= v*v;
   }
   _count--;
   _computed = false;
@@ -59,7 +59,9 @@
 #include <math.h>
 #include <memory.h>
 #include <cstdlib>
+#include <algorithm>
 #include "LKVector.h"
+#include "Allocator.h"
 #include "alizeString.h"
 #include "Exception.h"
 
@@ -67,7 +69,8 @@ using namespace alize;
 
 //-------------------------------------------------------------------------
 LKVector::LKVector(unsigned long capacity, unsigned long size)
-:Object(), _capacity(capacity!=0?capacity:1), _size(0),
+:Object(), sumNonTopDistribWeights(0.0), sumNonTopDistribLK(0.0),
+topDistribsCount(0), _capacity(capacity!=0?capacity:1), _size(0),
 _array(createArray()) { setSize(size); }
 
 //-------------------------------------------------------------------------
@@ -106,7 +109,8 @@ const LKVector& LKVector::operator=(const LKVector& obj){
 LKVector::type* LKVector::createArray() const // private
 {
   assert(_capacity != 0);
-  type* p = new (std::nothrow) type[_capacity];
+  type* p = static_cast<type*>(
+              Allocator::allocateAligned(_capacity*sizeof(type)));
   assertMemoryIsAllocated(p, __FILE__, __LINE__);
   return p;
 }
@@ -134,7 +138,7 @@ void LKVector::addValue(type element)
     type* oldArray = _array;
     _array = createArray(); // can throw OutOfMemoryException
     memcpy(_array, oldArray, _size*sizeof(_array[0]));
-    delete[] oldArray;
+    Allocator::deallocateAligned(oldArray);
   }
   _array[_size] = element;
   _size++;
@@ -152,7 +156,7 @@ void LKVector::pack(unsigned long size)
 		s = size;
 	}
     memcpy(_array, oldArray, s*sizeof(_array[0]));
-    delete[] oldArray;
+    Allocator::deallocateAligned(oldArray);
 }
 //-------------------------------------------------------------------------
 void LKVector::setSize(unsigned long size)
@@ -166,7 +170,7 @@ void LKVector::setSize(unsigned long size)
     type* oldArray = _array;
     _array = createArray(); // can throw OutOfMemoryException
     memcpy(_array, oldArray, oldSize*sizeof(_array[0]));
-    delete[] oldArray;
+    Allocator::deallocateAligned(oldArray);
   }
   else
     _size = size;
@@ -187,6 +191,18 @@ void LKVector::descendingSort() const
   qsort(_array, _size, sizeof(type), compare);
 }
 //-------------------------------------------------------------------------
+bool LKVector::greater(const type& a, const type& b) // static method
+{ return a.lk > b.lk; }
+//-------------------------------------------------------------------------
+void LKVector::descendingSort(unsigned long k) const
+{
+  assert(_array != NULL);
+  if (k >= _size)
+    std::sort(_array, _array+_size, greater);
+  else // heap of k elements : O(size*log(k))
+    std::partial_sort(_array, _array+k, _array+_size, greater);
+}
+//-------------------------------------------------------------------------
 LKVector::type* LKVector::getArray() const { return _array; }
 //-------------------------------------------------------------------------
 void LKVector::clear() { _size = 0; }
@@ -207,7 +223,7 @@ String LKVector::toString() const
   return s;
 }
 //-------------------------------------------------------------------------
-LKVector::~LKVector() { delete[] _array; }
+LKVector::~LKVector() { Allocator::deallocateAligned(_array); }
 //-------------------------------------------------------------------------
 
 #endif  // ALIZE_LKVector_cpp
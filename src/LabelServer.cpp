@@ -66,7 +66,7 @@ using namespace alize;
 
 //-------------------------------------------------------------------------
 LabelServer::LabelServer(bool usePredefinedLabels)
-:Object(), _first(0), _lastAdded(0)
+:Object(), _first(0), _lastAdded(0), _indexIsValid(true)
 {
   if (usePredefinedLabels)
   {
@@ -86,26 +86,58 @@ unsigned long LabelServer::addLabel(const Label& l, bool forceAdd)
     if (l == getLabel(_lastAdded)) // operator!= overloaded
       return _lastAdded;
     // search for an identical label
-    unsigned long s = size();
-    for (unsigned long i=0; i<s; i++)
+    long i = findLabel(l);
+    if (i != -1) // if an identical label exists
     {
-      if (getLabel(i) == l) // if an identical label exists
-      {
-        _lastAdded = i;
-        return _lastAdded;
-      }
+      _lastAdded = i;
+      return _lastAdded;
     }
   }
   // adds a new label
-  _vect.addObject(l.duplicate());
-  _lastAdded = size()-1;
+  _lastAdded = _vect.addObject(l.duplicate());
+  if (_indexIsValid)
+    indexLabel(_lastAdded);
   return _lastAdded;
 }
 //-------------------------------------------------------------------------
+long LabelServer::findLabel(const Label& l) const // private
+{
+  if (!_indexIsValid)
+    indexLabels();
+  std::map<key_t, unsigned long>::const_iterator it =
+              _map.find(key_t(l.getString(), l.getSourceName()));
+  if (it == _map.end())
+    return -1;
+  if (getLabel(it->second) == l)
+    return (long)it->second;
+  // the label has been modified through getLabel() : rebuilds the index
+  indexLabels();
+  it = _map.find(key_t(l.getString(), l.getSourceName()));
+  return it == _map.end() ? -1 : (long)it->second;
+}
+//-------------------------------------------------------------------------
+void LabelServer::indexLabel(unsigned long i) const // private
+{
+  const Label& l = getLabel(i);
+  // insert() does not replace an existing entry : the first label is kept
+  _map.insert(std::make_pair(key_t(l.getString(), l.getSourceName()), i));
+  _stringMap.insert(std::make_pair(l.getString(), i));
+}
+//-------------------------------------------------------------------------
+void LabelServer::indexLabels() const // private
+{
+  _map.clear();
+  _stringMap.clear();
+  for (unsigned long i=0; i<_vect.size(); i++)
+    indexLabel(i);
+  _indexIsValid = true;
+}
+//-------------------------------------------------------------------------
 void LabelServer::setLabel(const Label& l, unsigned long i) const
 {
   delete &_vect.getObject(i); // can throw IndexOutOfBoundsException
   _vect.setObject(l.duplicate(), i);
+  _indexIsValid = false;
 }
 //-------------------------------------------------------------------------
 Label& LabelServer::getLabel(unsigned long index) const
@@ -116,11 +148,16 @@ Label& LabelServer::getLabel(unsigned long index) const
 //-------------------------------------------------------------------------
 long LabelServer::getLabelIndexByString(const String& s) const
 {
-  unsigned long size = _vect.size();
-  for (unsigned long i=0; i<size; i++)
-    if (_vect.getObject(i).getString() == s)
-      return (long)i;
-  return -1;
+  if (!_indexIsValid)
+    indexLabels();
+  std::map<String, unsigned long>::const_iterator it = _stringMap.find(s);
+  if (it == _stringMap.end())
+    return -1;
+  if (getLabel(it->second).getString() == s)
+    return (long)it->second;
+  indexLabels(); // the label has been modified through getLabel()
+  it = _stringMap.find(s);
+  return it == _stringMap.end() ? -1 : (long)it->second;
 }
 //-------------------------------------------------------------------------
 void LabelServer::clear(bool deletePreDefined)
@@ -128,6 +165,8 @@ void LabelServer::clear(bool deletePreDefined)
   if (deletePreDefined)
     _first = 0;
   _vect.deleteAllObjects(_first);
+  _lastAdded = 0;
+  _indexIsValid = false;
 }
 //-------------------------------------------------------------------------
 unsigned long LabelServer::size() const { return _vect.size(); }
@@ -62,15 +62,22 @@
 using namespace alize;
 typedef MixtureDict D;
 
+static const unsigned long NONE = (unsigned long)-1;
+
 //-------------------------------------------------------------------------
 D::MixtureDict()
-:Object() {}
+:Object(), _lruFirst(NONE), _lruLast(NONE), _cachedMemory(0) {}
 //-------------------------------------------------------------------------
 Mixture& D::getMixture(unsigned long i) const
 { return _vect.getObject(i); }
 //-------------------------------------------------------------------------
 unsigned long D::addMixture(Mixture& m)
-{ return _map[m.getId()] = _vect.addObject(m); }
+{
+  _lruPrevVect.addValue(NONE);
+  _lruNextVect.addValue(NONE);
+  _memVect.addValue(0);
+  return _map[m.getId()] = _vect.addObject(m);
+}
 //-------------------------------------------------------------------------
 long D::getIndexOfId(const String& id) const
 {
@@ -104,27 +111,163 @@ void D::deleteMixtures(unsigned long first, unsigned long last)
     return;
   if (last>size()-1)
     last = size()-1;
+  RefVector<Mixture> lruVect;
+  ULongVector memVect;
+  getLRUOrder(lruVect, memVect, first, last);
   unsigned long i=first;
   for (; i<=last; i++)
     _map.erase(getMixture(i).getId());
   _vect.removeObjects(first, last, DELETE);
   for (i=first;i<_vect.size(); i++)
     _map.find(getMixture(i).getId())->second = i;
+  setLRUOrder(lruVect, memVect);
 }
 //-------------------------------------------------------------------------
 void D::deleteMixture(const Mixture& m)
 {
   unsigned long i = getIndexOfId(m.getId());
+  RefVector<Mixture> lruVect;
+  ULongVector memVect;
+  getLRUOrder(lruVect, memVect, i, i);
   _map.erase(m.getId());
   delete &_vect.removeObject(m);
   for (;i<_vect.size(); i++)
     _map.find(getMixture(i).getId())->second = i;
+  setLRUOrder(lruVect, memVect);
+}
+//-------------------------------------------------------------------------
+void D::deleteMixtureFast(unsigned long i)
+{
+  Mixture& m = getMixture(i); // can throw IndexOutOfBoundsException
+  unsigned long* prev = _lruPrevVect.getArray();
+  unsigned long* next = _lruNextVect.getArray();
+  unsigned long* mem = _memVect.getArray();
+  if (mem[i] != 0)
+  {
+    unlink(i);
+    _cachedMemory -= mem[i];
+  }
+  _map.erase(m.getId());
+  delete &m;
+  const unsigned long last = _vect.size()-1;
+  if (i != last)
+  {
+    Mixture& l = getMixture(last);
+    _vect.setObject(l, i);
+    _map.find(l.getId())->second = i;
+    mem[i] = mem[last];
+    if (mem[i] != 0)
+    {
+      prev[i] = prev[last];
+      next[i] = next[last];
+      if (prev[i] != NONE)
+        next[prev[i]] = i;
+      else
+        _lruFirst = i;
+      if (next[i] != NONE)
+        prev[next[i]] = i;
+      else
+        _lruLast = i;
+    }
+  }
+  _vect.removeObjects(last, last);
+  _lruPrevVect.setSize(last);
+  _lruNextVect.setSize(last);
+  _memVect.setSize(last);
+}
+//-------------------------------------------------------------------------
+void D::setCached(unsigned long i, unsigned long memory)
+{
+  assertIsInBounds(__FILE__, __LINE__, i, _vect.size());
+  if (memory == 0)
+    memory = 1;
+  if (_memVect[i] != 0)
+  {
+    unlink(i);
+    _cachedMemory -= _memVect[i];
+  }
+  _memVect[i] = memory;
+  _cachedMemory += memory;
+  linkLast(i);
+}
+//-------------------------------------------------------------------------
+void D::touch(unsigned long i) const
+{
+  if (i < _vect.size() && _memVect.getArray()[i] != 0 && i != _lruLast)
+  {
+    unlink(i);
+    linkLast(i);
+  }
+}
+//-------------------------------------------------------------------------
+long D::getLeastRecentlyUsed() const
+{ return _lruFirst == NONE ? -1 : (long)_lruFirst; }
+//-------------------------------------------------------------------------
+unsigned long D::getCachedMemory() const { return _cachedMemory; }
+//-------------------------------------------------------------------------
+void D::unlink(unsigned long i) const // private
+{
+  unsigned long* prev = _lruPrevVect.getArray();
+  unsigned long* next = _lruNextVect.getArray();
+  if (prev[i] != NONE)
+    next[prev[i]] = next[i];
+  else
+    _lruFirst = next[i];
+  if (next[i] != NONE)
+    prev[next[i]] = prev[i];
+  else
+    _lruLast = prev[i];
+  prev[i] = next[i] = NONE;
+}
+//-------------------------------------------------------------------------
+void D::linkLast(unsigned long i) const // private
+{
+  unsigned long* prev = _lruPrevVect.getArray();
+  unsigned long* next = _lruNextVect.getArray();
+  prev[i] = _lruLast;
+  next[i] = NONE;
+  if (_lruLast != NONE)
+    next[_lruLast] = i;
+  else
+    _lruFirst = i;
+  _lruLast = i;
+}
+//-------------------------------------------------------------------------
+void D::getLRUOrder(RefVector<Mixture>& v, ULongVector& mem,
+                    unsigned long f, unsigned long l) const // private
+{ // mixtures of the list outside [f, l]
+  for (unsigned long i=_lruFirst; i!=NONE; i=_lruNextVect[i])
+    if (i < f || i > l)
+    {
+      v.addObject(getMixture(i));
+      mem.addValue(_memVect[i]);
+    }
+}
+//-------------------------------------------------------------------------
+void D::setLRUOrder(const RefVector<Mixture>& v, const ULongVector& mem)
+{ // private
+  const unsigned long n = _vect.size();
+  _lruPrevVect.setSize(n);
+  _lruNextVect.setSize(n);
+  _memVect.setSize(n);
+  _lruPrevVect.setAllValues(NONE);
+  _lruNextVect.setAllValues(NONE);
+  _memVect.setAllValues(0);
+  _lruFirst = _lruLast = NONE;
+  _cachedMemory = 0;
+  for (unsigned long i=0; i<v.size(); i++)
+    setCached(getIndexOfId(v.getObject(i).getId()), mem[i]);
 }
 //-------------------------------------------------------------------------
 void D::clear()
 {
   _vect.deleteAllObjects();
   _map.clear();
+  _lruPrevVect.clear();
+  _lruNextVect.clear();
+  _memVect.clear();
+  _lruFirst = _lruLast = NONE;
+  _cachedMemory = 0;
 }
 //-------------------------------------------------------------------------
 unsigned long D::size() const { return _vect.size(); }
@@ -216,9 +216,10 @@ void W::writeMixtureGF_XML(const MixtureGF& m)
 //-------------------------------------------------------------------------
 void W::writeMixtureGD_RAW(const MixtureGD& m)
 {
-  unsigned long v, c;
+  unsigned long c;
+  const unsigned long vectSize = m.getVectSize();
   writeUInt4(m.getDistribCount());
-  writeUInt4(m.getVectSize());
+  writeUInt4(vectSize);
   for (c=0; c<m.getDistribCount(); c++)
     writeDouble(m.weight(c));
   for (c=0; c<m.getDistribCount(); c++)
@@ -227,18 +228,15 @@ void W::writeMixtureGD_RAW(const MixtureGD& m)
     writeDouble(d.getCst());
     writeDouble(d.getDet());
     writeChar((char)0); // not used
-    for (v=0; v<m.getVectSize(); v++)
-      writeDouble(d.getCovInv(v));
-
-    for (v=0; v<m.getVectSize(); v++)
-      writeDouble(d.getMean(v));
+    writeDoubles(d.getCovInvVect().getArray(), vectSize);
+    writeDoubles(d.getMeanVect().getArray(), vectSize);
   }
 }
 //-------------------------------------------------------------------------
 void W::writeMixtureGD_ETAT(const MixtureGD& m)
 {
   writeUInt4(3); // aux = LHM_STATE_FILE = 3
-  unsigned long i,d, c;
+  unsigned long i,d;
   // tag = file name ?
   for (i=0; i<_fileName.length() && i<63; i++)
     writeString(_fileName[i]);
@@ -257,10 +255,8 @@ void W::writeMixtureGD_ETAT(const MixtureGD& m)
     writeShort(0); // type = LHM_GAUSS = 0
     writeShort((short)m.getVectSize()); // tpar
     DistribGD& dis = m.getDistrib(d);
-    for (c=0; c<dis.getVectSize(); c++)
-      writeDouble(dis.getMean(c));
-    for (c=0; c<dis.getVectSize(); c++)
-      writeDouble(dis.getCov(c));
+    writeDoubles(dis.getMeanVect().getArray(), dis.getVectSize());
+    writeDoubles(dis.getCovVect().getArray(), dis.getVectSize());
     writeDouble(-2.0*log(dis.getCst()));
   }
 }
@@ -286,8 +282,7 @@ void W::writeMixtureGF_RAW(const MixtureGF& m)
       for (vv=0; vv<vectSize; vv++)
         writeDouble(d.getCovInv(v, vv));
 
-    for (v=0; v<m.getVectSize(); v++)
-      writeDouble(d.getMean(v));
+    writeDoubles(d.getMeanVect().getArray(), vectSize);
   }
 }
 //-------------------------------------------------------------------------
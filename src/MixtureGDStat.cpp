@@ -63,15 +63,18 @@
 #include "Mixture.h"
 #include "MixtureGD.h"
 #include "DistribRefVector.h"
+#include "LKVector.h"
 #include "Config.h"
 #include "Exception.h"
+#include "Counters.h"
 
 using namespace alize;
 typedef MixtureGDStat M;
 
 //-------------------------------------------------------------------------
 M::MixtureGDStat(const K&, StatServer& ss, const MixtureGD& m, const Config& c)
-:MixtureStat(ss, m, c), _pMixForAccumulation(NULL), _pMixtureForEM(NULL) {}
+:MixtureStat(ss, m, c), _pMixForAccumulation(NULL), _pMixtureForEM(NULL),
+ _resetedMAP(false), _mapMode(MAPAdaptMode_MEAN) {}
 //-------------------------------------------------------------------------
 MixtureGDStat& M::create(const K&, StatServer& ss,
                                      const MixtureGD& m, const Config& c)
@@ -86,41 +89,42 @@ void M::resetEM()
   assert(_pMixture->getDistribCount() == _distribCount);
   resetOcc();
 
-  // copy the original mixture and its ditributions
-  if (_pMixtureForEM != NULL)
-    delete _pMixtureForEM;
-  _pMixtureForEM = &static_cast<MixtureGD&>(_pMixture->duplicate(K::k,
-                                            DUPL_DISTRIB));
-  // create and initialize a temporary mixtureGD to accumulate cov and mean
-  if (_pMixForAccumulation != NULL)
-    delete _pMixForAccumulation;
-  _pMixForAccumulation = &MixtureGD::create(K::k, "",
-                      _pMixtureForEM->getVectSize(),
-                      _pMixtureForEM->getDistribCount());
-  for (unsigned long c=0; c<_distribCount; c++)
+  // copy the original mixture and its ditributions. The copy is made once
+  // and then overwritten in place
+  const MixtureGD& m = static_cast<const MixtureGD&>(*_pMixture);
+  if (_pMixtureForEM == NULL)
+    _pMixtureForEM = &m.duplicate(K::k, DUPL_DISTRIB);
+  else
   {
-    DistribGD& d = _pMixForAccumulation->getDistrib(c);
-    d.getMeanVect().setAllValues(0.0);
-    d.getCovVect().setAllValues(0.0);
+    *_pMixtureForEM = m;
+    if (_pMixtureForEM->getId() != m.getId())
+      _pMixtureForEM->setId(K::k, m.getId());
   }
+  resetAccumulators(true);
   _featureCounterForEM = 0.0;
   _resetedEM = true;
+  _resetedMAP = false;
 }
 //-------------------------------------------------------------------------
 occ_t M::computeAndAccumulateEM(const Feature& f, double w)
 {
   assertResetEMDone();
+  Counters::Timer timer(Counters::EM_TIME);
   real_t sum = computeAndAccumulateOcc(f, w);
 
   Feature::data_t* dataVect = f.getDataVector();
   real_t t, *meanVect, *covVect;
   unsigned long vectSize = _pMixture->getVectSize();
+  const unsigned long* idx = _occIndexVect.getArray();
+  const unsigned long n = _occIndexVect.size();
+  Counters::add(Counters::EM_FEATURES, 1);
+  Counters::add(Counters::EM_DISTRIBS_UPDATED, n);
 
-  for (unsigned long c=0; c<_distribCount; c++)
+  for (unsigned long j=0; j<n; j++)
   {
-    DistribGD& d = _pMixForAccumulation->getDistrib(c);
-    meanVect = d.getMeanVect().getArray();
-    covVect  = d.getCovVect().getArray();
+    const unsigned long c = idx[j];
+    meanVect = getAccMeanArray(c);
+    covVect  = getAccCovArray(c);
     
     for (unsigned long i=0; i<vectSize; i++)
     {
@@ -144,7 +148,6 @@ void M::addAccEM(const MixtureStat& mx)
 
   _accumulatedOccVect += m._accumulatedOccVect;
   _featureCounterForAccumulatedOcc += m._featureCounterForAccumulatedOcc;
-
   for (unsigned long c=0; c<_distribCount; c++)
   {
     DistribGD& d = _pMixForAccumulation->getDistrib(c);
@@ -158,50 +161,254 @@ void M::addAccEM(const MixtureStat& mx)
 const Mixture& M::getEM()
 {
   assertResetEMDone();
+  Counters::Timer timer(Counters::EM_TIME);
   unsigned long c;
 
   occ_t totOcc = _accumulatedOccVect.computeSum();
   unsigned long vectSize = _pMixture->getVectSize();
+  real_t* covWork = _covWorkVect.getArray();
 
   for (c=0; c<_distribCount; c++)
   {
     const occ_t occ = _accumulatedOccVect[c];
     if (occ > 0.0)
     {
-      DistribGD& dTmp = _pMixForAccumulation->getDistrib(c);
-      real_t* dTmpCovVect  = dTmp.getCovVect().getArray();
-      real_t* dTmpMeanVect = dTmp.getMeanVect().getArray();
+      const real_t* accCovVect  = getAccCovArray(c);
+      const real_t* accMeanVect = getAccMeanArray(c);
 
       DistribGD& d  = _pMixtureForEM->getDistrib(c);
-      real_t* dCovVect   = d.getCovVect().getArray();
       real_t* dMeanVect  = d.getMeanVect().getArray();
 
       real_t mean, cov;
 
       for (unsigned long i=0; i<vectSize; i++)
       {
-        mean = dTmpMeanVect[i] / occ;
-        cov  = dTmpCovVect [i] / occ - mean * mean;
+        mean = accMeanVect[i] / occ;
+        cov  = accCovVect [i] / occ - mean * mean;
         if (cov >MIN_COV)
-          dCovVect [i] = cov;
+          covWork[i] = cov;
         else
-          dCovVect [i] = MIN_COV;
+          covWork[i] = MIN_COV;
         dMeanVect[i] = mean;
       }
       _pMixtureForEM->weight(c) = occ/totOcc;
-      d.computeAll();
+      d.computeAll(K::k, covWork);
     }
   }
   return *_pMixtureForEM;
 }
 //-------------------------------------------------------------------------
+void M::getAccEMArrays(unsigned long c, real_t*& mean, real_t*& cov,
+                       unsigned long& covSize) const // private
+{
+  covSize = _pMixture->getVectSize();
+  mean = getAccMeanArray(c);
+  cov = getAccCovArray(c);
+}
+//-------------------------------------------------------------------------
 MixtureGD& M::getInternalAccumEM()
 {
   assertResetEMDone();
-  assert(_pMixForAccumulation != NULL);
   return *_pMixForAccumulation;
 }
 //-------------------------------------------------------------------------
+void M::resetAccumulators(bool cov) // private
+{
+  // the accumulation mixture is created once and then zeroed in place
+  const unsigned long vectSize = _pMixture->getVectSize();
+  if (_pMixForAccumulation == NULL)
+  {
+    _pMixForAccumulation = &MixtureGD::create(K::k, "", vectSize,
+                                              _distribCount);
+    _covWorkVect.setSize(vectSize, true);
+  }
+  for (unsigned long c=0; c<_distribCount; c++)
+  {
+    DistribGD& d = _pMixForAccumulation->getDistrib(c);
+    d.getMeanVect().setAllValues(0.0);
+    if (cov)
+      d.getCovVect().setAllValues(0.0);
+  }
+}
+//-------------------------------------------------------------------------
+real_t* M::getAccMeanArray(unsigned long c) const // private
+{ return _pMixForAccumulation->getDistrib(c).getMeanVect().getArray(); }
+//-------------------------------------------------------------------------
+real_t* M::getAccCovArray(unsigned long c) const // private
+{ return _pMixForAccumulation->getDistrib(c).getCovVect().getArray(); }
+//-------------------------------------------------------------------------
+void M::resetMAP(MAPAdaptMode mode)
+{
+  assert(_pMixture->getDistribCount() == _distribCount);
+  resetOcc();
+
+  resetAccumulators(mode == MAPAdaptMode_MEAN_WEIGHT_COV);
+  _mapMode = mode;
+  _resetedEM = false;
+  _resetedMAP = true;
+}
+//-------------------------------------------------------------------------
+void M::accumulateMAP(const real_t* dataVect, unsigned long c) // private
+{
+  const unsigned long vectSize = _pMixture->getVectSize();
+  const real_t occ = _occVect[c];
+  real_t* meanVect = getAccMeanArray(c);
+  unsigned long i;
+
+  if (_mapMode == MAPAdaptMode_MEAN_WEIGHT_COV)
+  {
+    real_t t, *covVect = getAccCovArray(c);
+    for (i=0; i<vectSize; i++)
+    {
+      t = occ * dataVect[i];
+      covVect[i]  += t * dataVect[i];
+      meanVect[i] += t;
+    }
+  }
+  else
+  {
+    for (i=0; i<vectSize; i++)
+      meanVect[i] += occ * dataVect[i];
+  }
+}
+//-------------------------------------------------------------------------
+occ_t M::computeAndAccumulateMAP(const Feature& f, double w)
+{
+  assertResetMAPDone();
+  real_t sum = computeAndAccumulateOcc(f, w);
+  const real_t* dataVect = f.getDataVector();
+  const unsigned long* idx = _occIndexVect.getArray();
+  const unsigned long n = _occIndexVect.size();
+
+  for (unsigned long j=0; j<n; j++)
+    accumulateMAP(dataVect, idx[j]);
+  return sum;
+}
+//-------------------------------------------------------------------------
+occ_t M::computeAndAccumulateMAP(const Feature& f,
+                                 const LKVector& topDistribs, double w)
+{
+  assertResetMAPDone();
+  if (topDistribs.size() != _distribCount)
+    throw Exception("top distributions vector incompatible with the mixture",
+                    __FILE__, __LINE__);
+  if (f.getVectSize() != _pMixture->getVectSize())
+    throw Exception("feature vectSize incompatible with the mixture",
+                    __FILE__, __LINE__);
+  const real_t EPS_APP = 1e-200; // same as MixtureStat::computeOccVect()
+  unsigned long i, c, nTop = topDistribs.topDistribsCount;
+  if (nTop > _distribCount)
+    nTop = _distribCount;
+  const LKVector::type* v = topDistribs.getArray();
+  const weight_t* weightVect = _pMixture->getTabWeight().getArray();
+  Distrib** distribVect = _pMixture->getTabDistrib();
+  occ_t* occVect = _occVect.getArray();
+  occ_t* accOccVect = _accumulatedOccVect.getArray();
+  const real_t* dataVect = f.getDataVector();
+  occ_t sum = 0.0;
+
+  _occVect.setAllValues(0.0);
+  for (i=0; i<nTop; i++)
+  {
+    c = v[i].idx;
+    assert(c < _distribCount);
+    const DistribGD* d = static_cast<const DistribGD*>(distribVect[c]);
+    sum += (occVect[c] = weightVect[c] * d->computeLK(K::k, _lkKernel,
+                                                      dataVect));
+  }
+  for (i=0; i<nTop; i++)
+  {
+    c = v[i].idx;
+    if (sum > EPS_APP)
+      occVect[c] = occVect[c] / sum * w;
+    else
+      occVect[c] = EPS_APP * w;
+    accOccVect[c] += occVect[c];
+    accumulateMAP(dataVect, c);
+  }
+  _featureCounterForAccumulatedOcc += w;
+  return sum > EPS_APP ? sum : EPS_APP;
+}
+//-------------------------------------------------------------------------
+void M::adaptMAP(MixtureGD& m, real_t meanRelevance, real_t weightRelevance,
+                 real_t covRelevance) const
+{
+  assertResetMAPDone();
+  if (meanRelevance < 0.0 || weightRelevance < 0.0 || covRelevance < 0.0)
+    throw Exception("negative relevance factor", __FILE__, __LINE__);
+  const MixtureGD& prior = static_cast<const MixtureGD&>(*_pMixture);
+  if (&m != &prior)
+    m = prior; // can throw Exception if the sizes are different
+
+  const unsigned long vectSize = m.getVectSize();
+  const occ_t* accOccVect = _accumulatedOccVect.getArray();
+  real_t* covWork = _covWorkVect.getArray();
+  unsigned long c, i;
+
+  if (_mapMode != MAPAdaptMode_MEAN)
+  {
+    const occ_t totOcc = _accumulatedOccVect.computeSum();
+    if (totOcc > 0.0)
+    {
+      weight_t sum = 0.0;
+      for (c=0; c<_distribCount; c++)
+      {
+        const occ_t n = accOccVect[c];
+        const real_t a = (n > 0.0) ? n / (n + weightRelevance) : 0.0;
+        sum += (m.weight(c) = a * n / totOcc + (1.0 - a) * m.weight(c));
+      }
+      for (c=0; c<_distribCount; c++)
+        m.weight(c) /= sum;
+    }
+  }
+  for (c=0; c<_distribCount; c++)
+  {
+    const occ_t n = accOccVect[c];
+    if (!(n > 0.0))
+      continue; // keeps the prior
+    DistribGD& d = m.getDistrib(c);
+    real_t* meanVect = d.getMeanVect().getArray();
+    const real_t* accMeanVect = getAccMeanArray(c);
+
+    if (_mapMode == MAPAdaptMode_MEAN_WEIGHT_COV)
+    {
+      const real_t* accCovVect = getAccCovArray(c);
+      const real_t* covInvVect = d.getCovInvVect().getArray();
+      real_t mean, cov;
+
+      for (i=0; i<vectSize; i++)
+      {
+        mean = meanVect[i];
+        cov = 1.0 / covInvVect[i] + mean * mean; // prior second moment
+        mean = (accMeanVect[i] + meanRelevance * mean) / (n + meanRelevance);
+        cov = (accCovVect[i] + covRelevance * cov) / (n + covRelevance)
+              - mean * mean;
+        if (cov > MIN_COV)
+          covWork[i] = cov;
+        else
+          covWork[i] = MIN_COV;
+        meanVect[i] = mean;
+      }
+      d.computeAll(K::k, covWork);
+    }
+    else
+    {
+      for (i=0; i<vectSize; i++)
+        meanVect[i] = (accMeanVect[i] + meanRelevance * meanVect[i])
+                      / (n + meanRelevance);
+    }
+  }
+}
+//-------------------------------------------------------------------------
+void M::adaptMAP(MixtureGD& m, real_t relevance) const
+{ adaptMAP(m, relevance, relevance, relevance); }
+//-------------------------------------------------------------------------
+void M::assertResetMAPDone() const // private
+{
+  if (!_resetedMAP)
+    throw Exception("MAP not reseted", __FILE__, __LINE__);
+}
+//-------------------------------------------------------------------------
 String M::getClassName() const { return "MixtureGDStat"; }
 //-------------------------------------------------------------------------
 M::~MixtureGDStat()
@@ -127,9 +127,12 @@ occ_t M::computeAndAccumulateEM(const Feature& f, double w)
   Feature::data_t* dataVect = f.getDataVector();
   unsigned long vectSize = _pMixture->getVectSize();
   unsigned long vectSize2 = vectSize*vectSize;
+  const unsigned long* idx = _occIndexVect.getArray();
+  const unsigned long n = _occIndexVect.size();
 
-  for (unsigned long c=0; c<_distribCount; c++)
+  for (unsigned long k=0; k<n; k++)
   {
+    const unsigned long c = idx[k];
     DistribGF& d = _pMixForAccumulation->getDistrib(c);
     real_t* dTmpMeanVect = d.getMeanVect().getArray();
     real_t* dTmpCovMatr  = d.getCovMatrix().getArray();
@@ -209,6 +212,15 @@ const Mixture& M::getEM()
   return *_pMixtureForEM;
 }
 //-------------------------------------------------------------------------
+void M::getAccEMArrays(unsigned long c, real_t*& mean, real_t*& cov,
+                       unsigned long& covSize) const // private
+{
+  DistribGF& d = _pMixForAccumulation->getDistrib(c);
+  mean = d.getMeanVect().getArray();
+  cov = d.getCovMatrix().getArray();
+  covSize = d.getVectSize()*d.getVectSize();
+}
+//-------------------------------------------------------------------------
 MixtureGF& M::getInternalAccumEM()
 {
   assertResetEMDone();
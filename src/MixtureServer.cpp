@@ -58,6 +58,9 @@
 //#include <cstdlib>
 
 #include <ctime>
+#include <new>
+#include <memory.h>
+#include <algorithm>
 #include "MixtureServer.h"
 #include "MixtureFileReader.h"
 #include "MixtureServerFileReader.h"
@@ -258,6 +261,41 @@ DistribGF& S::duplicateDistrib(const DistribGF& d)
   return static_cast<DistribGD&>(duplicateDistrib(*p));
 }*/
 //-------------------------------------------------------------------------
+void S::replicate(const MixtureServer& s)
+{
+  if (&s == this)
+    return;
+  // the source is read without touching its LRU list
+  const unsigned long first = _distribDict.size();
+  const unsigned long distribCount = s._distribDict.size();
+  const unsigned long mixtureCount = s._mixtureDict.size();
+  unsigned long i, c;
+
+  if (s._vectSizeDefined)
+  {
+    if (_vectSizeDefined && _vectSize != s._vectSize)
+      throw Exception("Incompatible vectSize", __FILE__, __LINE__);
+    _vectSize = s._vectSize;
+    _vectSizeDefined = true;
+  }
+  for (i=0; i<distribCount; i++)
+    duplicateDistrib(s._distribDict.getDistrib(i));
+  for (i=0; i<mixtureCount; i++)
+  {
+    const Mixture& src = s._mixtureDict.getMixture(i);
+    const unsigned long n = src.getDistribCount();
+    String id(src.getId());
+    unsigned long cpt = 1;
+    while (_mixtureDict.getIndexOfId(id) != -1) // if the id already exists
+      id = src.getId() + " #" + String::valueOf(++cpt);
+    Mixture& m = createMixture(0, src.getType());
+    for (c=0; c<n; c++)
+      addDistribToMixture(m, _distribDict.getDistrib(first
+                    + src.getDistrib(c).dictIndex(K::k)), src.weight(c));
+    setMixtureId(m, id);
+  }
+}
+//-------------------------------------------------------------------------
 Distrib& S::duplicateDistrib(const Distrib& distrib)
 {
   Distrib& d = distrib.duplicate(K::k);
@@ -266,7 +304,71 @@ Distrib& S::duplicateDistrib(const Distrib& distrib)
 }
 //-------------------------------------------------------------------------
 long S::getMixtureIndex(const String& id) const
-{ return _mixtureDict.getIndexOfId(id); }
+{
+  long i = _mixtureDict.getIndexOfId(id);
+  if (i != -1)
+    _mixtureDict.touch(i);
+  else if (_config.existsParam_mixtureServerCacheMemAlloc
+           && _config.getParam_mixtureServerCacheMemAlloc() != 0)
+    i = const_cast<S*>(this)->loadMixtureOnDemand(id);
+  return i;
+}
+//-------------------------------------------------------------------------
+long S::loadMixtureOnDemand(const String& id) // private
+{
+  Mixture* p;
+  try { p = &loadMixture(id); }
+  catch (FileNotFoundException&) { return -1; }
+  _mixtureDict.setCached(_mixtureDict.getIndexOfId(id),
+                         getMixtureMemory(*p));
+  const unsigned long maxMemory =
+                         _config.getParam_mixtureServerCacheMemAlloc();
+  long i;
+  while (_mixtureDict.getCachedMemory() > maxMemory
+         && (i = _mixtureDict.getLeastRecentlyUsed()) != -1
+         && &_mixtureDict.getMixture(i) != p)
+    deleteMixtureOnDemand(i);
+  return _mixtureDict.getIndexOfId(id);
+}
+//-------------------------------------------------------------------------
+void S::deleteMixtureOnDemand(unsigned long i) // private
+{
+  Mixture& m = _mixtureDict.getMixture(i);
+  const unsigned long n = m.getDistribCount();
+  Distrib** v = new (std::nothrow) Distrib*[n+1];
+  assertMemoryIsAllocated(v, __FILE__, __LINE__);
+  memcpy(v, m.getTabDistrib(), n*sizeof(v[0]));
+  std::sort(v, v+n); // a distribution can be used twice by the mixture
+  const unsigned long distribCount = std::unique(v, v+n)-v;
+  _mixtureDict.deleteMixtureFast(i);
+  // deletes the distributions now referenced only by the server
+  for (unsigned long c=0; c<distribCount; c++)
+  {
+    const unsigned long j = v[c]->dictIndex(K::k);
+    if (_distribDict.deleteUnreferencedDistribFast(j)
+        && j < _distribDict.size())
+      _distribDict.getDistrib(j).dictIndex(K::k) = j;
+  }
+  delete [] v;
+}
+//-------------------------------------------------------------------------
+unsigned long S::getMixtureMemory(const Mixture& m) // private static
+{
+  const unsigned long v = m.getVectSize();
+  unsigned long mixtureMemory, distribMemory;
+  if (m.getType() == DistribType_GF)
+  {
+    mixtureMemory = sizeof(MixtureGF);
+    distribMemory = sizeof(DistribGF) + (2*v*v+2*v)*sizeof(real_t);
+  }
+  else
+  {
+    mixtureMemory = sizeof(MixtureGD);
+    distribMemory = sizeof(DistribGD) + 3*v*sizeof(real_t);
+  }
+  return mixtureMemory + m.getDistribCount()
+         *(distribMemory+sizeof(weight_t)+sizeof(Distrib*));
+}
 //-------------------------------------------------------------------------
 void S::setDistribToMixture(Mixture& m, Distrib& d, weight_t w,
                             unsigned long i)
@@ -365,11 +467,14 @@ DistribGF& S::getDistribGF(unsigned long i) const
 unsigned long S::getMixtureCount() const { return _mixtureDict.size(); }
 //-------------------------------------------------------------------------
 Mixture& S::getMixture(unsigned long i) const
-{ return _mixtureDict.getMixture(i); }
+{
+  _mixtureDict.touch(i);
+  return _mixtureDict.getMixture(i);
+}
 //-------------------------------------------------------------------------
 MixtureGD& S::getMixtureGD(unsigned long i) const
 {
-  MixtureGD* p = dynamic_cast<MixtureGD*>(&_mixtureDict.getMixture(i));
+  MixtureGD* p = dynamic_cast<MixtureGD*>(&getMixture(i));
   if (p == NULL)
     throw Exception("The mixture found is not a GD", __FILE__, __LINE__);
   return *p;
@@ -377,7 +482,7 @@ MixtureGD& S::getMixtureGD(unsigned long i) const
 //-------------------------------------------------------------------------
 MixtureGF& S::getMixtureGF(unsigned long i) const
 {
-  MixtureGF* p = dynamic_cast<MixtureGF*>(&_mixtureDict.getMixture(i));
+  MixtureGF* p = dynamic_cast<MixtureGF*>(&getMixture(i));
   if (p == NULL)
     throw Exception("The mixture found is not a GF", __FILE__, __LINE__);
   return *p;
@@ -407,6 +512,8 @@ void S::deleteMixture(const Mixture& m)
 void S::deleteUnusedDistribs()
 {
   _distribDict.deleteUnreferencedDistribs();
+  for (unsigned long i=0; i<getDistribCount(); i++)
+    getDistrib(i).dictIndex(K::k) = i;
   if (getDistribCount() == 0 && getMixtureCount() == 0)
     _vectSizeDefined = false;
 }
@@ -174,7 +174,7 @@ void W::writeMixtureGDXml(const MixtureGD& m)
 //-------------------------------------------------------------------------
 void W::writeMixtureServerRaw(const MixtureServer& ms)
 {
-  unsigned long i, c;
+  unsigned long i;
   writeString("MixtureServer");
   writeUInt4(ms.getServerName().length());
   writeString(ms.getServerName());
@@ -195,11 +195,8 @@ void W::writeMixtureServerRaw(const MixtureServer& ms)
     {
       writeString("GD");
       writeString("f"); // unused
-      for (c=0; c<p->getVectSize(); c++)
-       writeDouble(p->getCovInv(c));
-
-      for (c=0; c<p->getVectSize(); c++)
-        writeDouble(p->getMean(c));
+      writeDoubles(p->getCovInvVect().getArray(), p->getVectSize());
+      writeDoubles(p->getMeanVect().getArray(), p->getVectSize());
     }
     else
       throw Exception("I don't know how to save a "
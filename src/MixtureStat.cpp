@@ -60,14 +60,22 @@
 #include "alizeString.h"
 #include "Mixture.h"
 #include "Distrib.h"
+#include "DistribGD.h"
 #include "Exception.h"
 #include "Feature.h"
 #include "Config.h"
 #include "RealVector.h"
 #include "StatServer.h"
+#include "FileReader.h"
+#include "FileWriter.h"
+#include "ByteSwap.h"
+#include "AutoDestructor.h"
 
 using namespace alize;
 typedef MixtureStat S;
+
+static const char* ACC_EM_MAGIC = "ALZACCEM";
+
 //-------------------------------------------------------------------------
 S::MixtureStat(StatServer& ss, const Mixture& m, const Config& c)
 :Object(), _distribCount(m.getDistribCount()), _pMixture(&m), _config(c), 
@@ -75,8 +83,18 @@ S::MixtureStat(StatServer& ss, const Mixture& m, const Config& c)
  _accumulatedLLK(0), _occVect(_distribCount, _distribCount),
  _accumulatedOccVect(_distribCount, _distribCount),
  _meanOccVect(_distribCount, _distribCount), _resetedEM(false),
- _pStatServer(&ss), _featureCounterForEM(0.0)
+ _pStatServer(&ss), _featureCounterForEM(0.0),
+ _occPruningThreshold(c.existsParam_occPruningThreshold ?
+                      c.getParam_occPruningThreshold() : 0.0),
+ _occPruningTopDistribsCount(c.existsParam_occPruningTopDistribsCount ?
+                      c.getParam_occPruningTopDistribsCount() : 0),
+ _occIndexVect(_distribCount, _distribCount), _occLKVect(0, 0),
+ _lkKernel(DistribGD::getLKKernel(m))
 {
+  for (unsigned long c=0; c<_distribCount; c++)
+    _occIndexVect[c] = c;
+  if (_occPruningTopDistribsCount != 0)
+    _occLKVect.setSize(_distribCount);
   resetLLK();
   resetOcc();
 }
@@ -168,16 +186,29 @@ real_t S::computeOccVect(const Feature& f) // private
   Distrib** distribVect = _pMixture->getTabDistrib();
   occ_t*  occVect   = _occVect.getArray(); 
 
-  for (c=0; c<_distribCount; c++)
+  if (_lkKernel != NULL && f.getVectSize() == _pMixture->getVectSize())
   {
-    Distrib* d = distribVect[c];
-    occVect[c] = weightVect[c] * d->computeLK(f);
-    sum += _occVect[c];
+    const real_t* data = f.getDataVector();
+    for (c=0; c<_distribCount; c++)
+    {
+      const DistribGD* d = static_cast<const DistribGD*>(distribVect[c]);
+      occVect[c] = weightVect[c] * d->computeLK(K::k, _lkKernel, data);
+      sum += occVect[c];
+    }
   }
+  else
+    for (c=0; c<_distribCount; c++)
+    {
+      Distrib* d = distribVect[c];
+      occVect[c] = weightVect[c] * d->computeLK(f);
+      sum += _occVect[c];
+    }
   if (sum > EPS_APP) /* si la trame a un poids non negligeable */
   {
     for (c=0; c<_distribCount; c++)
     { _occVect[c] /= sum; } /* normalisation   Somme des occ = 1 */
+    if (_occPruningThreshold > 0.0 || _occPruningTopDistribsCount != 0)
+      pruneOccVect();
   }
   else /* si la trame a un poids negligeable */
   {
@@ -187,10 +218,75 @@ real_t S::computeOccVect(const Feature& f) // private
         _occVect[c] = EPS_APP;
     }
     sum  = EPS_APP;
+    if (_occIndexVect.size() != _distribCount)
+    {
+      _occIndexVect.setSize(_distribCount);
+      for (c=0; c<_distribCount; c++)
+        _occIndexVect[c] = c;
+    }
   }
   return sum;
 }
 //-------------------------------------------------------------------------
+void S::pruneOccVect() // private
+{
+  occ_t* occVect = _occVect.getArray();
+  unsigned long* idx = _occIndexVect.getArray(); // capacity = distribCount
+  unsigned long i, c, n = 0;
+  occ_t kept = 0.0;
+
+  if (_occPruningTopDistribsCount != 0 &&
+      _occPruningTopDistribsCount < _distribCount)
+  {
+    LKVector::type* v = _occLKVect.getArray();
+    for (c=0; c<_distribCount; c++)
+    {
+      v[c].idx = c;
+      v[c].lk = occVect[c];
+    }
+    _occLKVect.descendingSort(_occPruningTopDistribsCount);
+    // at least the best distribution is kept
+    for (n=0; n<_occPruningTopDistribsCount; n++)
+    {
+      if (n != 0 && v[n].lk < _occPruningThreshold)
+        break;
+      idx[n] = v[n].idx;
+      kept += v[n].lk;
+    }
+    _occVect.setAllValues(0.0);
+    for (i=0; i<n; i++)
+      occVect[v[i].idx] = v[i].lk / kept;
+  }
+  else
+  {
+    unsigned long best = 0;
+    occ_t bestOcc = 0.0;
+    for (c=0; c<_distribCount; c++)
+    {
+      if (occVect[c] > bestOcc)
+      {
+        best = c;
+        bestOcc = occVect[c];
+      }
+      if (occVect[c] >= _occPruningThreshold)
+      {
+        idx[n++] = c;
+        kept += occVect[c];
+      }
+      else
+        occVect[c] = 0.0;
+    }
+    if (n == 0) // at least the best distribution is kept
+    {
+      idx[n++] = best;
+      kept = occVect[best] = bestOcc;
+    }
+    for (i=0; i<n; i++)
+      occVect[idx[i]] /= kept;
+  }
+  _occIndexVect.setSize(n);
+}
+//-------------------------------------------------------------------------
 DoubleVector& S::getOccVect() { return _occVect; }
 //-------------------------------------------------------------------------
 const DoubleVector& S::getOccVect() const { return _occVect; }
@@ -230,6 +326,84 @@ void S::assertResetEMDone() const
     throw Exception("EM not reseted", __FILE__, __LINE__);
 }
 //-------------------------------------------------------------------------
+void S::saveAccEM(const FileName& f) const
+{
+  assertResetEMDone();
+  const unsigned long vectSize = _pMixture->getVectSize();
+  real_t* mean = NULL;
+  real_t* cov = NULL;
+  unsigned long covSize = 0;
+  if (_distribCount != 0)
+    getAccEMArrays(0, mean, cov, covSize);
+  FileWriter w(f);
+  w.open(); // can throw IOException
+  w.writeString(ACC_EM_MAGIC);
+  w.writeByteOrderCheck();
+  w.writeChar(_pMixture->getType() == DistribType_GD ? 'D' : 'F');
+  w.writeUInt4(_distribCount);
+  w.writeUInt4(vectSize);
+  w.writeUInt4(covSize);
+  w.writeDouble(_featureCounterForEM);
+  w.writeDouble(_featureCounterForAccumulatedOcc);
+  w.writeDoubles(_accumulatedOccVect.getArray(), _distribCount);
+  for (unsigned long c=0; c<_distribCount; c++)
+  {
+    getAccEMArrays(c, mean, cov, covSize);
+    w.writeDoubles(mean, vectSize);
+    w.writeDoubles(cov, covSize);
+  }
+  w.close();
+}
+//-------------------------------------------------------------------------
+void S::addAccEM(const FileName& f)
+{
+  assertResetEMDone();
+  FileReader& r = FileReader::create(f, "", "", false);
+  AutoDestructor ad(r);
+  const unsigned long vectSize = _pMixture->getVectSize();
+  real_t* mean = NULL;
+  real_t* cov = NULL;
+  unsigned long covSize = 0;
+  if (_distribCount != 0)
+    getAccEMArrays(0, mean, cov, covSize);
+  if (r.readString(8) != ACC_EM_MAGIC)
+    throw InvalidDataException("Not an EM accumulator file",
+                               __FILE__, __LINE__, f);
+  r.readByteOrderCheck(); // can throw InvalidDataException
+  const char type = r.readChar();
+  if (type != (_pMixture->getType() == DistribType_GD ? 'D' : 'F')
+      || r.readUInt4() != _distribCount || r.readUInt4() != vectSize
+      || r.readUInt4() != covSize)
+    throw InvalidDataException("EM accumulators incompatible with the"
+          " mixture " + _pMixture->getId(), __FILE__, __LINE__, f);
+  // all the data is read before being added
+  const real_t featureCounterForEM = r.readDouble();
+  const real_t featureCounterForAccumulatedOcc = r.readDouble();
+  const unsigned long distribSize = vectSize+covSize;
+  const unsigned long n = _distribCount*(1+distribSize);
+  const unsigned long length = n*sizeof(real_t);
+  DoubleVector v(n, n);
+  if (r.readSomeBytes(v.getArray(), length) != length)
+    throw EOFException("", __FILE__, __LINE__, f);
+  if (r.swap()) // file written with the other byte order
+    ByteSwap::swap8(v.getArray(), n);
+  const real_t* p = v.getArray();
+  unsigned long c, i;
+  real_t* occ = _accumulatedOccVect.getArray();
+  for (c=0; c<_distribCount; c++)
+    occ[c] += *p++;
+  for (c=0; c<_distribCount; c++)
+  {
+    getAccEMArrays(c, mean, cov, covSize);
+    for (i=0; i<vectSize; i++)
+      mean[i] += *p++;
+    for (i=0; i<covSize; i++)
+      cov[i] += *p++;
+  }
+  _featureCounterForEM += featureCounterForEM;
+  _featureCounterForAccumulatedOcc += featureCounterForAccumulatedOcc;
+}
+//-------------------------------------------------------------------------
 String S::toString() const
 // TODO : a completer
 {
@@ -0,0 +1,176 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_Numa_cpp)
+#define ALIZE_Numa_cpp
+
+#include <cstdio>
+#include "Numa.h"
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+using namespace alize;
+
+#if defined(__linux__)
+namespace
+{
+  // Reads a list like "0-3,8,10-11" (cpulist or node list of /sys).
+  // Calls f(i) for each value and returns the number of values
+  template <class F> unsigned long readList(const char* fileName, F& f)
+  {
+    FILE* file = fopen(fileName, "r");
+    if (file == NULL)
+      return 0;
+    unsigned long n = 0, a, b;
+    int c;
+    while (fscanf(file, "%lu", &a) == 1)
+    {
+      b = a;
+      c = fgetc(file);
+      if (c == '-')
+      {
+        if (fscanf(file, "%lu", &b) != 1)
+          break;
+        c = fgetc(file);
+      }
+      for (; a<=b; a++, n++)
+        f(a);
+      if (c != ',')
+        break;
+    }
+    fclose(file);
+    return n;
+  }
+  struct NodeFinder
+  {
+    unsigned long wanted, index, node;
+    bool found;
+    void operator()(unsigned long v)
+    {
+      if (index++ == wanted)
+      {
+        node = v;
+        found = true;
+      }
+    }
+  };
+  struct Counter { void operator()(unsigned long) {} };
+  struct CpuSetter
+  {
+    cpu_set_t set;
+    void operator()(unsigned long cpu)
+    {
+      if (cpu < CPU_SETSIZE)
+        CPU_SET(cpu, &set);
+    }
+  };
+}
+#endif
+//-------------------------------------------------------------------------
+unsigned long Numa::getNodeCount()
+{
+#if defined(__linux__)
+  Counter c;
+  const unsigned long n = readList("/sys/devices/system/node/has_cpu", c);
+  return n != 0 ? n : 1;
+#else
+  return 1;
+#endif
+}
+//-------------------------------------------------------------------------
+bool Numa::bindThreadToNode(unsigned long node)
+{
+#if defined(__linux__)
+  if (getNodeCount() <= 1)
+    return node == 0;
+  // the nodes may not be numbered contiguously
+  NodeFinder finder;
+  finder.wanted = node;
+  finder.index = finder.node = 0;
+  finder.found = false;
+  readList("/sys/devices/system/node/has_cpu", finder);
+  if (!finder.found)
+    return false;
+  char fileName[64];
+  sprintf(fileName, "/sys/devices/system/node/node%lu/cpulist", finder.node);
+  CpuSetter setter;
+  CPU_ZERO(&setter.set);
+  if (readList(fileName, setter) == 0)
+    return false;
+  return sched_setaffinity(0, sizeof(setter.set), &setter.set) == 0;
+#else
+  return node == 0;
+#endif
+}
+//-------------------------------------------------------------------------
+void Numa::getPartition(unsigned long itemCount, unsigned long nodeCount,
+                        unsigned long node, unsigned long& first,
+                        unsigned long& count)
+{
+  if (nodeCount == 0 || node >= nodeCount)
+  {
+    first = itemCount;
+    count = 0;
+    return;
+  }
+  const unsigned long q = itemCount/nodeCount, r = itemCount%nodeCount;
+  // the r first nodes get one more item
+  first = node*q + (node < r ? node : r);
+  count = q + (node < r ? 1 : 0);
+}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_Numa_cpp)
@@ -71,9 +71,43 @@ using namespace alize;
 unsigned long Object::_creationCounter = 0;
 unsigned long Object::_destructionCounter = 0;
 unsigned long Object::_max = 0;
-#endif
 
-bool Object::_initialized = false;
+// The counters are updated with atomic operations because objects can be
+// created and destroyed by several threads at the same time
+#if defined(_MSC_VER)
+#include <intrin.h>
+static unsigned long atomicIncrement(unsigned long& x)
+{ return (unsigned long)_InterlockedIncrement((volatile long*)&x); }
+static unsigned long atomicLoad(unsigned long& x)
+{ return (unsigned long)_InterlockedOr((volatile long*)&x, 0); }
+static unsigned long atomicCompareAndSwap(unsigned long& x,
+                            unsigned long oldValue, unsigned long newValue)
+{
+  return (unsigned long)_InterlockedCompareExchange((volatile long*)&x,
+                            (long)newValue, (long)oldValue);
+}
+#else
+static unsigned long atomicIncrement(unsigned long& x)
+{ return __sync_add_and_fetch(&x, 1UL); }
+static unsigned long atomicLoad(unsigned long& x)
+{ return __sync_fetch_and_add(&x, 0UL); }
+static unsigned long atomicCompareAndSwap(unsigned long& x,
+                            unsigned long oldValue, unsigned long newValue)
+{ return __sync_val_compare_and_swap(&x, oldValue, newValue); }
+#endif
+//-------------------------------------------------------------------------
+static void updateMax(unsigned long& max, unsigned long diff)
+{
+  unsigned long m = atomicLoad(max);
+  while (diff > m)
+  {
+    const unsigned long p = atomicCompareAndSwap(max, m, diff);
+    if (p == m)
+      break;
+    m = p;
+  }
+}
+#endif
 const real_t Object::MIN_COV = 1e-200;
 const real_t Object::EPS_LK = 1e-200;
 const real_t Object::PI = 3.14159265358979323846;
@@ -89,26 +123,20 @@ namespace alize
 //-------------------------------------------------------------------------
 Object::Object()
 {
-  if (!_initialized)
-  {
-    if (sizeof(char)      != 1 ||
-      sizeof(short)     != 2 ||
-      sizeof(int)       != 4 ||
-      sizeof(unsigned int)  != 4 ||
-      //sizeof(long)      != 4 || // == 8 sur IA64
-      //sizeof(unsigned long) != 4 ||
-      sizeof(float)     != 4 ||
-      sizeof(double)    != 8 )
-      exit(-1); // TODO : yes, but what to do ?
-
-    _initialized = true;
-  }
+  // constant condition : no shared flag to test (reentrant)
+  if (sizeof(char)      != 1 ||
+    sizeof(short)     != 2 ||
+    sizeof(int)       != 4 ||
+    sizeof(unsigned int)  != 4 ||
+    //sizeof(long)      != 4 || // == 8 sur IA64
+    //sizeof(unsigned long) != 4 ||
+    sizeof(float)     != 4 ||
+    sizeof(double)    != 8 )
+    exit(-1); // TODO : yes, but what to do ?
 
 #if !defined NDEBUG
-  _creationCounter++;
-  unsigned long diff = _creationCounter-_destructionCounter;
-  if (diff > _max)
-    _max = diff;
+  const unsigned long created = atomicIncrement(_creationCounter);
+  updateMax(_max, created-atomicLoad(_destructionCounter));
 #endif
 }
 //-------------------------------------------------------------------------
@@ -127,13 +155,13 @@ bool Object::isSameObject(const Object& o) const
 //-------------------------------------------------------------------------
 #if !defined NDEBUG
 unsigned long Object::getCreationCounter() // static method
-{ return _creationCounter; }
+{ return atomicLoad(_creationCounter); }
 //-------------------------------------------------------------------------
 unsigned long Object::getDestructionCounter() // static method
-{ return _destructionCounter; throw Exception("", "", 1);}
+{ return atomicLoad(_destructionCounter); }
 //-------------------------------------------------------------------------
 unsigned long Object::getMax() // static method
-{ return _max; }
+{ return atomicLoad(_max); }
 #endif
 //-------------------------------------------------------------------------
 void Object::assertIsInBounds(const char* fileName, int line, 
@@ -221,6 +249,8 @@ FeatureFileReaderFormat Object::getFeatureFileReaderFormat(const String& name)
     return FeatureFileReaderFormat_RAW;
   if (name == "HTK")
     return FeatureFileReaderFormat_HTK;
+  if (name == "AUDIO")
+    return FeatureFileReaderFormat_AUDIO;
   throw Exception("Unavailable feature file format name '" + name + "'",
                             __FILE__, __LINE__);
   return FeatureFileReaderFormat_RAW; // never called
@@ -317,10 +347,8 @@ MixtureFileReaderFormat Object::getMixtureFileReaderFormat(const String& name)
 Object::~Object()
 {
 #if !defined NDEBUG
-  _destructionCounter++;
-  unsigned long diff = _creationCounter-_destructionCounter;
-  if (diff > _max)
-    _max = diff;
+  const unsigned long destroyed = atomicIncrement(_destructionCounter);
+  updateMax(_max, atomicLoad(_creationCounter)-destroyed);
 #endif
 }
 //-------------------------------------------------------------------------
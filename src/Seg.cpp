@@ -57,6 +57,7 @@
 
 #include "Seg.h"
 #include "Exception.h"
+#include "SegServer.h"
 #include <new>
 
 using namespace alize;
@@ -69,9 +70,8 @@ Seg::Seg(SegServer& ss, unsigned long b, unsigned long l, unsigned long lc,
 Seg& Seg::create(const K&, SegServer& ss, unsigned long b, unsigned long l,
     unsigned long lc, const String& s, const String& sn) // static
 {
-  Seg* p = new (std::nothrow) Seg(ss, b, l, lc, s, sn);
-  assertMemoryIsAllocated(p, __FILE__, __LINE__);
-  return *p;
+  // the memory is owned by the server
+  return *new (ss.allocateSeg(K::k)) Seg(ss, b, l, lc, s, sn);
 }
 //-------------------------------------------------------------------------
 Seg& Seg::duplicate(const K&, SegServer& ss) const
@@ -81,9 +81,17 @@ Seg& Seg::duplicate(const K&, SegServer& ss) const
   return s;
 }
 //-------------------------------------------------------------------------
-void Seg::setBegin(unsigned long b) { _begin = b; }
+void Seg::setBegin(unsigned long b)
+{
+  _begin = b;
+  invalidateOwnersIndex(K::k);
+}
 //-------------------------------------------------------------------------
-void Seg::setLength(unsigned long l) { _length = l; }
+void Seg::setLength(unsigned long l)
+{
+  _length = l;
+  invalidateOwnersIndex(K::k);
+}
 //-------------------------------------------------------------------------
 Seg* Seg::getSeg() const
 {
@@ -127,6 +135,7 @@ Seg& Seg::merge(Seg& s)
     end = s._begin + s._length;
   _begin = begin;
   _length = end-begin;
+  invalidateOwnersIndex(K::k);
   if (_string != s._string)
     _string += " " + s._string;
   if (_srcName != s._srcName)
@@ -151,7 +160,7 @@ Seg& Seg::split(unsigned long i)
   Seg& newSeg = duplicate();
   newSeg.setBegin(i);
   newSeg.setLength(_length-i+_begin);
-  _length = i-_begin;
+  setLength(i-_begin);
   return newSeg;
 }
 //-------------------------------------------------------------------------
@@ -64,7 +64,7 @@ using namespace alize;
 //-------------------------------------------------------------------------
 SegAbstract::SegAbstract(SegServer& ss, unsigned long lc, const String& s,
              const String& sn)
-:Object(), _labelCode(lc), _string(s), _srcName(sn), _pServer(&ss)
+:Object(), _labelCode(lc), _string(s), _srcName(sn), _pServer(&ss), _idx(0)
 { rewind(); }
 //-------------------------------------------------------------------------
 /*void SegAbstract::assign(const SegAbstract& s)
@@ -88,7 +88,11 @@ const String& SegAbstract::sourceName() const { return _srcName; }
 //-------------------------------------------------------------------------
 SegServer& SegAbstract::getServer() const { return *_pServer; }
 //-------------------------------------------------------------------------
-void SegAbstract::setLabelCode(unsigned long lc) { _labelCode = lc; }
+void SegAbstract::setLabelCode(unsigned long lc)
+{
+  _labelCode = lc;
+  invalidateOwnersIndex(K::k);
+}
 //-------------------------------------------------------------------------
 void SegAbstract::setString(const String& s) { _string = s; }
 //-------------------------------------------------------------------------
@@ -107,6 +111,19 @@ void SegAbstract::removeAllOwners(const K&)
     static_cast<SegCluster&>(_ownersVect.getObject(0)).remove(*this);
 }
 //-------------------------------------------------------------------------
+void SegAbstract::detachOwners(const K&)
+{ _ownersVect.clear(); } // the owners are destroyed by the server
+//-------------------------------------------------------------------------
+unsigned long SegAbstract::getIndex(const K&) const { return _idx; }
+//-------------------------------------------------------------------------
+void SegAbstract::setIndex(const K&, unsigned long idx) { _idx = idx; }
+//-------------------------------------------------------------------------
+void SegAbstract::invalidateOwnersIndex(const K&) const
+{
+  for (unsigned long i=0; i<_ownersVect.size(); i++)
+    static_cast<SegCluster&>(_ownersVect.getObject(i)).invalidateIndex(K::k);
+}
+//-------------------------------------------------------------------------
 void SegAbstract::rewind() const { _current = 0; }
 //-------------------------------------------------------------------------
 String SegAbstract::getClassName() const { return "SegAbstract"; }
@@ -61,6 +61,7 @@
 #include <new>
 #include "limits.h"
 #include <iostream>
+#include <algorithm>
 
 using namespace alize;
 using namespace std;
@@ -68,14 +69,14 @@ typedef SegCluster C;
 //-------------------------------------------------------------------------
 C::SegCluster(SegServer& ss, unsigned long lc, const String& s,
                                                           const String& sn)
-:SegAbstract(ss, lc, s, sn), _pCurrentSeg(NULL) { rewind(); }
+:SegAbstract(ss, lc, s, sn), _pCurrentSeg(NULL), _indexIsValid(false)
+{ rewind(); }
 //-------------------------------------------------------------------------
 SegCluster& C::create(const K&, SegServer& ss, unsigned long lc,
                       const String& s, const String& sn)
 {
-  SegCluster* p = new (std::nothrow) SegCluster(ss, lc, s, sn);
-  assertMemoryIsAllocated(p, __FILE__, __LINE__);
-  return *p;
+  // the memory is owned by the server
+  return *new (ss.allocateCluster(K::k)) SegCluster(ss, lc, s, sn);
 }
 //-------------------------------------------------------------------------
 /*C::SegCluster(const SegCluster& s)
@@ -145,6 +146,7 @@ void C::add(SegAbstract& s)
     throw Exception("Cannot add a extern segment", __FILE__, __LINE__);
   _vect.addObject(s);
   s.addOwner(K::k, *this);
+  invalidateIndex(K::k);
 }
 //-------------------------------------------------------------------------
 void C::add(SegAbstract& s, unsigned long pos)
@@ -153,6 +155,7 @@ void C::add(SegAbstract& s, unsigned long pos)
     throw Exception("Cannot add a extern segment", __FILE__, __LINE__);
   _vect.addObject(s, pos);
   s.addOwner(K::k, *this);
+  invalidateIndex(K::k);
 }
 //-------------------------------------------------------------------------
 Seg& C::addCopy(const Seg& s)
@@ -160,6 +163,7 @@ Seg& C::addCopy(const Seg& s)
   Seg& seg = getServer().duplicateSeg(s);
   _vect.addObject(seg);
   seg.addOwner(K::k, *this);
+  invalidateIndex(K::k);
   return seg;
 }
 //-------------------------------------------------------------------------
@@ -168,6 +172,7 @@ Seg& C::addCopy(const Seg& s, unsigned long pos)
   Seg& seg = getServer().duplicateSeg(s);
   _vect.addObject(seg, pos);
   seg.addOwner(K::k, *this);
+  invalidateIndex(K::k);
   return seg;
 }
 //-------------------------------------------------------------------------
@@ -177,6 +182,7 @@ Seg& C::addNewSeg(unsigned long b, unsigned long l, unsigned long lc,
   Seg& seg = getServer().createSeg(b, l, lc, s, sn);
   _vect.addObject(seg);
   seg.addOwner(K::k, *this);
+  invalidateIndex(K::k);
   return seg;
 }
 //-------------------------------------------------------------------------
@@ -184,6 +190,7 @@ void C::remove(SegAbstract& s)
 {
   s.removeOwner(K::k, *this);
   _vect.removeObject(s);
+  invalidateIndex(K::k);
 }
 //-------------------------------------------------------------------------
 SegAbstract& C::remove(unsigned long i)
@@ -191,6 +198,7 @@ SegAbstract& C::remove(unsigned long i)
   SegAbstract& s = get(i);
   s.removeOwner(K::k, *this);
   _vect.removeObject(i);
+  invalidateIndex(K::k);
   return s;
 }
 //-------------------------------------------------------------------------
@@ -199,6 +207,27 @@ void C::removeAll()
   for (unsigned long i=0; i<_vect.size(); i++)
     get(i).removeOwner(K::k, *this);
   _vect.clear(); // do not call deleteAllObjects()
+  invalidateIndex(K::k);
+}
+//-------------------------------------------------------------------------
+void C::detachSegs(const K&)
+{
+  // the segments are all destroyed by the server : their owner lists
+  // are not updated
+  unsigned long j = 0;
+  for (unsigned long i=0; i<_vect.size(); i++)
+    if (dynamic_cast<Seg*>(&get(i)) == NULL)
+      _vect.setObject(get(i), j++);
+  if (j < _vect.size())
+    _vect.removeObjects(j, _vect.size()-1);
+  invalidateIndex(K::k);
+}
+//-------------------------------------------------------------------------
+void C::detachAll(const K&)
+{
+  _vect.clear(); // the components are destroyed by the server
+  _indexIsValid = false;
+  _pCurrentSeg = NULL;
 }
 //-------------------------------------------------------------------------
 unsigned long C::getCount() const { return _vect.size(); }
@@ -226,35 +255,104 @@ bool C::getFeatureLabelCode(unsigned long n, unsigned long& lc,
     lc = _lc;
     return true;
   }
-  _pStartSeg = NULL;
-
-  do
+  if (!_indexIsValid)
+    buildIndex();
+  _pCurrentSeg = NULL;
+  // elementary interval [bounds[j], bounds[j+1]) containing n
+  std::vector<unsigned long>::const_iterator it =
+     std::upper_bound(_indexBounds.begin(), _indexBounds.end(), n);
+  if (it == _indexBounds.begin() || it == _indexBounds.end())
+    return false;
+  const unsigned long j = (it-_indexBounds.begin())-1;
+  // the first segment containing n is the smallest position stored on
+  // the path from the leaf to the root
+  unsigned long pos = ULONG_MAX;
+  for (unsigned long i=j+_indexTree.size()/2; i>=1; i/=2)
+    if (_indexTree[i] < pos)
+      pos = _indexTree[i];
+  if (pos == ULONG_MAX)
+    return false;
+  const IndexEntry* pFound = &_index[pos];
+  _pCurrentSeg = pFound->pSeg;
+  _b = pFound->b;
+  _e = pFound->e;
+  isFirst = (n == _b);
+  isLast = (n == _e-1);
+  lc = _lc = _pCurrentSeg->labelCode();
+  return true;
+}
+//-------------------------------------------------------------------------
+void C::collectSegs(std::vector<IndexEntry>& v) const // private
+{
+  for (unsigned long i=0; i<_vect.size(); i++)
   {
-    _pCurrentSeg = getSeg();
-
-    if (_pCurrentSeg != NULL)
+    SegAbstract& s = get(i);
+    Seg* p = dynamic_cast<Seg*>(&s);
+    if (p == NULL)
     {
-      if (_pCurrentSeg == _pStartSeg)
-        break;
-      _b = _pCurrentSeg->begin();
-      _e = _b + _pCurrentSeg->length();
-      if (n >= _b && n < _e)
+      static_cast<SegCluster&>(s).collectSegs(v);
+      continue;
+    }
+    IndexEntry x;
+    x.b = p->begin();
+    x.e = x.b + p->length();
+    x.pSeg = p;
+    if (x.e > x.b) // empty segments are never found
+      v.push_back(x);
+  }
+}
+//-------------------------------------------------------------------------
+void C::buildIndex() const // private
+{
+  _index.clear();
+  collectSegs(_index);
+  const unsigned long n = _index.size();
+  _indexBounds.clear();
+  for (unsigned long i=0; i<n; i++)
+  {
+    _indexBounds.push_back(_index[i].b);
+    _indexBounds.push_back(_index[i].e);
+  }
+  std::sort(_indexBounds.begin(), _indexBounds.end());
+  _indexBounds.erase(std::unique(_indexBounds.begin(), _indexBounds.end()),
+                     _indexBounds.end());
+  // one leaf per elementary interval, the tree is a power of 2 wide
+  unsigned long leafCount = 1;
+  while (leafCount+1 < _indexBounds.size())
+    leafCount *= 2;
+  _indexTree.assign(2*leafCount, ULONG_MAX);
+  // a segment is stored on the O(log n) nodes covering its leaves.
+  // The segments are inserted by position : a node keeps the first one
+  for (unsigned long i=0; i<n; i++)
+  {
+    unsigned long l = std::lower_bound(_indexBounds.begin(),
+                _indexBounds.end(), _index[i].b)-_indexBounds.begin();
+    unsigned long r = std::lower_bound(_indexBounds.begin(),
+                _indexBounds.end(), _index[i].e)-_indexBounds.begin();
+    for (l+=leafCount, r+=leafCount; l<r; l/=2, r/=2)
+    {
+      if (l & 1)
+      {
+        if (_indexTree[l] == ULONG_MAX)
+          _indexTree[l] = i;
+        l++;
+      }
+      if (r & 1)
       {
-        isFirst = (n == _b);
-        isLast = (n == _e-1);
-        lc = _lc = _pCurrentSeg->labelCode();
-        return true;
+        r--;
+        if (_indexTree[r] == ULONG_MAX)
+          _indexTree[r] = i;
       }
-      if (_pStartSeg == NULL)
-        _pStartSeg = _pCurrentSeg;
     }
-    else
-      rewind();
   }
-  while (true);
-
+  _indexIsValid = true;
+}
+//-------------------------------------------------------------------------
+void C::invalidateIndex(const K&)
+{
+  _indexIsValid = false;
   _pCurrentSeg = NULL;
-  return false;
+  invalidateOwnersIndex(K::k); // parent clusters contain our segments
 }
 //-------------------------------------------------------------------------
 void C::getExtremeBoundaries(const K&, unsigned long& b,
@@ -64,12 +64,21 @@
 
 using namespace alize;
 
+// count of objects inside a block of a pool
+static const unsigned long POOL_BLOCK_SIZE = 1024;
+
 //-------------------------------------------------------------------------
 SegServer::SegServer()
-:Object(), _nextClusterId(0) {}
+:Object(), _removedSegCount(0), _removedClusterCount(0),
+ _firstRemovedSeg(0), _firstRemovedCluster(0),
+ _segPool(sizeof(Seg)), _clusterPool(sizeof(SegCluster)),
+ _nextClusterId(0) {}
 //-------------------------------------------------------------------------
 SegServer::SegServer(const SegServer& ss)
-:Object() { assign(ss); }
+:Object(), _removedSegCount(0), _removedClusterCount(0),
+ _firstRemovedSeg(0), _firstRemovedCluster(0),
+ _segPool(sizeof(Seg)), _clusterPool(sizeof(SegCluster)),
+ _nextClusterId(0) { assign(ss); }
 //-------------------------------------------------------------------------
 const SegServer& SegServer::operator=(const SegServer& ss)
 {
@@ -79,41 +88,37 @@ const SegServer& SegServer::operator=(const SegServer& ss)
 //-------------------------------------------------------------------------
 void SegServer::assign(const SegServer& ss)
 {
+  if (this == &ss)
+    return;
   removeAllSegs();
   removeAllClusters();
-  _map = ss._map;
   _nextClusterId = ss._nextClusterId;
   _serverName = ss._serverName;
   unsigned long i;
-  for (i=0; i<ss._segVect.size(); i++)
-  { _segVect.addObject(ss.getSeg(i).duplicate(K::k, *this)); }
-  for (i=0; i<ss._clusterVect.size(); i++)
+  for (i=0; i<ss.getSegCount(); i++)
+    duplicateSeg(ss.getSeg(i));
+  for (i=0; i<ss.getClusterCount(); i++)
+  {
+    SegCluster& newCluster = ss.getCluster(i).duplicate(K::k, *this);
+    newCluster.setId(K::k, ss.getCluster(i).getId());
+    newCluster.setIndex(K::k, _clusterVect.size());
+    _map[newCluster.getId()] = _clusterVect.size();
+    _clusterVect.push_back(&newCluster);
+  }
+  for (i=0; i<ss.getClusterCount(); i++)
   {
     const SegCluster& cl = ss.getCluster(i);
-    SegCluster& newCluster = cl.duplicate(K::k, *this);
-    newCluster.setId(K::k, cl.getId());
-    _clusterVect.addObject(newCluster);
     for (unsigned long j=0; j<cl.getCount(); j++)
-    { newCluster.add(matchingSegAbstract(cl.get(j))); }
+      getCluster(i).add(matchingSegAbstract(cl.get(j)));
   }
 }
 //-------------------------------------------------------------------------
 SegAbstract& SegServer::matchingSegAbstract(const SegAbstract& s) const
 {  // private
-  unsigned long i;
-  const SegServer& ss = s.getServer();
-  for (i=0; i<ss.getSegCount(); i++)
-  {
-    if (ss.getSeg(i).isSameObject(s))
-      return getSeg(i);
-  }
-  for (i=0; i<ss.getClusterCount(); i++)
-  {
-    if (ss.getCluster(i).isSameObject(s))
-      return getCluster(i);
-  }
-  assert(false);
-  return getSeg(0); // never called
+  unsigned long i = s.getServer().getIndex(s);
+  if (dynamic_cast<const Seg*>(&s) != NULL)
+    return getSeg(i);
+  return getCluster(i);
 }
 //-------------------------------------------------------------------------
 void SegServer::assertServerOwns(const SegAbstract& s) const // private
@@ -134,14 +139,16 @@ Seg& SegServer::createSeg(unsigned long b, unsigned long l,
              unsigned long lc, const String& s, const String& sn)
 {
   Seg& seg = Seg::create(K::k, *this, b, l, lc, s, sn);
-  _segVect.addObject(seg);
+  seg.setIndex(K::k, _segVect.size());
+  _segVect.push_back(&seg);
   return seg;
 }
 //-------------------------------------------------------------------------
 Seg& SegServer::duplicateSeg(const Seg& s)
 {
   Seg& seg = s.duplicate(K::k, *this);
-  _segVect.addObject(seg);
+  seg.setIndex(K::k, _segVect.size());
+  _segVect.push_back(&seg);
   return seg;
 }
 //-------------------------------------------------------------------------
@@ -152,50 +159,140 @@ SegCluster& SegServer::createCluster(unsigned long lc, const String& s,
   while ( getClusterIndexById(_nextClusterId) > 0)
     _nextClusterId++;
   cluster.setId(K::k, _nextClusterId);
-  _map[_nextClusterId] = _clusterVect.addObject(cluster);
+  cluster.setIndex(K::k, _clusterVect.size());
+  _map[_nextClusterId] = _clusterVect.size();
+  _clusterVect.push_back(&cluster);
   _nextClusterId++;
   return cluster;
 }
 //-------------------------------------------------------------------------
+void* SegServer::allocateSeg(const K&) { return _segPool.allocate(); }
+//-------------------------------------------------------------------------
+void* SegServer::allocateCluster(const K&)
+{ return _clusterPool.allocate(); }
+//-------------------------------------------------------------------------
 void SegServer::remove(SegAbstract& s)
 {
   assertServerOwns(s);
   s.removeAllOwners(K::k);
+  // the location is released without moving the other objects
   if (dynamic_cast<const Seg*>(&s) != NULL)
-    _segVect.removeObject(static_cast<Seg&>(s));
+  {
+    Seg* p = static_cast<Seg*>(&s);
+    assert(_segVect[p->getIndex(K::k)] == p);
+    _segVect[p->getIndex(K::k)] = NULL;
+    if (_removedSegCount++ == 0 || p->getIndex(K::k) < _firstRemovedSeg)
+      _firstRemovedSeg = p->getIndex(K::k);
+    p->~Seg();
+    _segPool.release(p);
+  }
   else
   {
-    SegCluster& cl = static_cast<SegCluster&>(s);
-    cl.removeAll();
-    _clusterVect.removeObject(cl);
-    _map.erase(cl.getId());
+    SegCluster* p = static_cast<SegCluster*>(&s);
+    p->removeAll();
+    assert(_clusterVect[p->getIndex(K::k)] == p);
+    _clusterVect[p->getIndex(K::k)] = NULL;
+    if (_removedClusterCount++ == 0
+        || p->getIndex(K::k) < _firstRemovedCluster)
+      _firstRemovedCluster = p->getIndex(K::k);
+    _map.erase(p->getId());
+    p->~SegCluster();
+    _clusterPool.release(p);
   }
-  delete &s;
 }
 //-------------------------------------------------------------------------
 void SegServer::removeAllSegs()
 {
-  while (getSegCount() != 0)
-    remove(getSeg(getSegCount()-1));
+  // the segments are removed from the clusters in one pass instead of
+  // being removed one by one from their owners
+  unsigned long i;
+  for (i=0; i<_clusterVect.size(); i++)
+    if (_clusterVect[i] != NULL)
+      _clusterVect[i]->detachSegs(K::k);
+  for (i=0; i<_segVect.size(); i++)
+    if (_segVect[i] != NULL)
+      _segVect[i]->~Seg();
+  _segVect.clear();
+  _removedSegCount = 0;
+  _segPool.reset();
 }
 //-------------------------------------------------------------------------
 void SegServer::removeAllClusters()
 {
-  while (getClusterCount() != 0)
-    remove(getCluster(getClusterCount()-1));
+  unsigned long i;
+  for (i=0; i<_clusterVect.size(); i++)
+    if (_clusterVect[i] != NULL)
+    {
+      _clusterVect[i]->detachAll(K::k);
+      _clusterVect[i]->detachOwners(K::k);
+    }
+  for (i=0; i<_segVect.size(); i++)
+    if (_segVect[i] != NULL)
+      _segVect[i]->detachOwners(K::k);
+  for (i=0; i<_clusterVect.size(); i++)
+    if (_clusterVect[i] != NULL)
+      _clusterVect[i]->~SegCluster();
+  _clusterVect.clear();
+  _removedClusterCount = 0;
+  _clusterPool.reset();
+  _map.clear();
   _nextClusterId = 0;
 }
 //-------------------------------------------------------------------------
+void SegServer::compactSegs(unsigned long idx) const // private
+{
+  // the locations before the first NULL do not move
+  if (_removedSegCount == 0 || idx < _firstRemovedSeg)
+    return;
+  unsigned long j = _firstRemovedSeg;
+  for (unsigned long i=j; i<_segVect.size(); i++)
+    if (_segVect[i] != NULL)
+    {
+      _segVect[j] = _segVect[i];
+      _segVect[j]->setIndex(K::k, j);
+      j++;
+    }
+  _segVect.resize(j);
+  _removedSegCount = 0;
+}
+//-------------------------------------------------------------------------
+void SegServer::compactClusters(unsigned long idx) const // private
+{
+  if (_removedClusterCount == 0 || idx < _firstRemovedCluster)
+    return;
+  unsigned long j = _firstRemovedCluster;
+  for (unsigned long i=j; i<_clusterVect.size(); i++)
+    if (_clusterVect[i] != NULL)
+    {
+      _clusterVect[j] = _clusterVect[i];
+      _clusterVect[j]->setIndex(K::k, j);
+      _map[_clusterVect[j]->getId()] = j;
+      j++;
+    }
+  _clusterVect.resize(j);
+  _removedClusterCount = 0;
+}
+//-------------------------------------------------------------------------
 Seg& SegServer::getSeg(unsigned long idx) const
-{ return _segVect.getObject(idx); }
+{
+  compactSegs(idx);
+  assertIsInBounds(__FILE__, __LINE__, idx, _segVect.size());
+  return *_segVect[idx];
+}
 //-------------------------------------------------------------------------
-unsigned long SegServer::getSegCount() const { return _segVect.size(); }
+unsigned long SegServer::getSegCount() const
+{ return _segVect.size()-_removedSegCount; }
 //-------------------------------------------------------------------------
 SegCluster& SegServer::getCluster(unsigned long idx) const
-{ return _clusterVect.getObject(idx); }
+{
+  compactClusters(idx);
+  assertIsInBounds(__FILE__, __LINE__, idx, _clusterVect.size());
+  return *_clusterVect[idx];
+}
 //-------------------------------------------------------------------------
 long SegServer::getClusterIndexById(unsigned long id) const
 {
+  compactClusters();
   it_t i = _map.find(id);
   if (i == _map.end())
     return -1;
@@ -209,6 +306,7 @@ void SegServer::setClusterId(SegCluster& cl, unsigned long id)
     throw Exception("Cluster with id='" + String::valueOf(id) +
           "' already exists in the server", __FILE__, __LINE__);
   unsigned long oldId = cl.getId();
+  compactClusters();
   unsigned long idx = _map.find(oldId)->second;
   _map.erase(oldId);
   _map[id] = idx;
@@ -217,6 +315,7 @@ void SegServer::setClusterId(SegCluster& cl, unsigned long id)
 //-------------------------------------------------------------------------
 SegCluster& SegServer::getClusterById(unsigned long id) const
 {
+  compactClusters();
   it_t i = _map.find(id);
   if (i == _map.end())
     throw Exception("Cluster with id='" + String::valueOf(id) +
@@ -228,28 +327,16 @@ unsigned long SegServer::getIndex(const SegAbstract& s) const
 {
   assertServerOwns(s);
   if (dynamic_cast<const Seg*>(&s) != NULL)
-  {
-    for (unsigned long i=0; i<_segVect.size(); i++)
-    {
-      if (_segVect.getObject(i).isSameObject(s))
-        return i;
-    }
-  }
+    compactSegs(s.getIndex(K::k));
   else if (dynamic_cast<const SegCluster*>(&s) != NULL)
-  {
-    for (unsigned long i=0; i<_segVect.size(); i++)
-    {
-      if (_clusterVect.getObject(i).isSameObject(s))
-        return i;
-    }
-  }
+    compactClusters(s.getIndex(K::k));
   else
     throw Exception("Unexpected object", __FILE__, __LINE__);
-  return 0; // never called
+  return s.getIndex(K::k);
 }
 //-------------------------------------------------------------------------
 unsigned long SegServer::getClusterCount() const
-{ return _clusterVect.size(); }
+{ return _clusterVect.size()-_removedClusterCount; }
 //-------------------------------------------------------------------------
 void SegServer::setServerName(const String& s) { _serverName = s; }
 //-------------------------------------------------------------------------
@@ -309,5 +396,51 @@ SegServer::~SegServer()
   removeAllSegs();
 }
 //-------------------------------------------------------------------------
+// class SegServer::Pool
+//-------------------------------------------------------------------------
+SegServer::Pool::Pool(unsigned long objectSize)
+:Object(), _objectSize(objectSize), _block(0), _used(0) {}
+//-------------------------------------------------------------------------
+void* SegServer::Pool::allocate()
+{
+  if (!_free.empty())
+  {
+    void* p = _free.back();
+    _free.pop_back();
+    return p;
+  }
+  if (_blocks.empty() || _used == POOL_BLOCK_SIZE)
+  {
+    if (_blocks.empty() || _block+1 == _blocks.size())
+    {
+      char* p = new (std::nothrow) char[POOL_BLOCK_SIZE*_objectSize];
+      assertMemoryIsAllocated(p, __FILE__, __LINE__);
+      _blocks.push_back(p);
+      _block = _blocks.size()-1;
+    }
+    else // blocks kept by reset()
+      _block++;
+    _used = 0;
+  }
+  return _blocks[_block] + _objectSize*_used++;
+}
+//-------------------------------------------------------------------------
+void SegServer::Pool::release(void* p) { _free.push_back(p); }
+//-------------------------------------------------------------------------
+void SegServer::Pool::reset()
+{
+  _free.clear();
+  _block = 0;
+  _used = 0;
+}
+//-------------------------------------------------------------------------
+String SegServer::Pool::getClassName() const { return "SegServer::Pool"; }
+//-------------------------------------------------------------------------
+SegServer::Pool::~Pool()
+{
+  for (unsigned long i=0; i<_blocks.size(); i++)
+    delete[] _blocks[i];
+}
+//-------------------------------------------------------------------------
 
 #endif // !defined(ALIZE_SegServer_cpp)
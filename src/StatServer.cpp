@@ -70,10 +70,12 @@
 
 #include "MixtureServer.h"
 #include "StatServer.h"
+#include "Counters.h"
 #include "MixtureStat.h"
 #include "MixtureGDStat.h"
 #include "MixtureGFStat.h"
 #include "Mixture.h"
+#include "DistribGD.h"
 #include "Exception.h"
 #include "Config.h"
 #include "RealVector.h"
@@ -91,6 +93,26 @@ using namespace std;
 
 
 typedef StatServer S;
+
+namespace
+{
+  // likelihood kernel used for the distributions of a mixture, selected
+  // once per call. NULL to use Distrib::computeLK() (mixture GF, or
+  // feature of another dimension : computeLK() throws the exception)
+  inline DistribGD::LKKernel getLKKernel(const Mixture& m, const Feature& f)
+  {
+    if (f.getVectSize() != m.getVectSize())
+      return NULL;
+    return DistribGD::getLKKernel(m);
+  }
+  inline lk_t computeDistribLK(const K& key, const Distrib* d,
+                 DistribGD::LKKernel k, const real_t* data, const Feature& f)
+  {
+    if (k != NULL)
+      return static_cast<const DistribGD*>(d)->computeLK(key, k, data);
+    return d->computeLK(f);
+  }
+}
 //-------------------------------------------------------------------------
 S::StatServer(const Config& c)
 :Object(), _config(c), _pMixtureServer(NULL), 
@@ -148,22 +170,28 @@ lk_t S::getMeanLLK(const Mixture& m) { return getMixtureStat(m).getMeanLLK(); }
 //-------------------------------------------------------------------------
 lk_t S::computeLLK(const Mixture& m, const Feature& f) const
 {
+  Counters::Timer timer(Counters::LLK_TIME);
   lk_t lk = 0.0;
   weight_t*  w = m.getTabWeight().getArray();
   Distrib**  d = m.getTabDistrib();
   unsigned long distribCount = m.getDistribCount();
+  Counters::add(Counters::LLK_DISTRIB_EVALUATIONS, distribCount);
+  const DistribGD::LKKernel k = getLKKernel(m, f);
+  const real_t* data = f.getDataVector();
   for (unsigned long c=0; c<distribCount; c++) {
-    lk += w[c] * d[c]->computeLK(f);
+    lk += w[c] * computeDistribLK(K::k, d[c], k, data, f);
   }
   return computeLLK(lk);
 }
 //-------------------------------------------------------------------------
 lk_t S::computeLLK(const Mixture& m, const Feature& f, unsigned long idx) const
 {
+  Counters::Timer timer(Counters::LLK_TIME);
   lk_t lk = 0.0;
   weight_t*  w = m.getTabWeight().getArray();
   Distrib**  d = m.getTabDistrib();
   unsigned long distribCount = m.getDistribCount();
+  Counters::add(Counters::LLK_DISTRIB_EVALUATIONS, distribCount);
   for (unsigned long c=0; c<distribCount; c++)
     lk += w[c] * d[c]->computeLK(f, idx);
   return computeLLK(lk);
@@ -201,12 +229,15 @@ lk_t S::computeLLK(const K&, const Mixture& m, const Feature& f,
   if (a == TOP_DISTRIBS_NO_ACTION)
     return computeLLK(m, f);
 
+  Counters::Timer timer(Counters::LLK_TIME);
   LKVector& lkVect = _topDistribsVect;
   lk_t lk = 0.0;
   weight_t* w = m.getTabWeight().getArray();
   Distrib** d = m.getTabDistrib();
   unsigned long distribCount = m.getDistribCount();
   unsigned long c, i, nTop = _config.getParam_topDistribsCount();
+  const DistribGD::LKKernel k = getLKKernel(m, f);
+  const real_t* data = f.getDataVector();
 
   if (a == USE_TOP_DISTRIBS)
   {
@@ -216,13 +247,14 @@ lk_t S::computeLLK(const K&, const Mixture& m, const Feature& f,
       throw Exception("", __FILE__, __LINE__);
     LKVector::type* v = lkVect.getArray();
     real_t sumTopDistribWeights = 0.0;
+    Counters::add(Counters::LLK_DISTRIB_EVALUATIONS, nTop);
 
     for (i=0; i<nTop; i++)
     {
       c = v[i].idx;
       sumTopDistribWeights += w[c];
       //lk += w[c] * d[c]->computeLK(f);
-      lk +=(v[c].lk =(w[c] * d[c]->computeLK(f)));
+      lk +=(v[c].lk =(w[c] * computeDistribLK(K::k, d[c], k, data, f)));
     }
     if (_config.getParam_computeLLKWithTopDistribs()) // COMPLETE
       lk += lkVect.sumNonTopDistribLK *
@@ -236,13 +268,14 @@ lk_t S::computeLLK(const K&, const Mixture& m, const Feature& f,
   lkVect.setSize(distribCount);
   LKVector::type* v = lkVect.getArray();
   lkVect.topDistribsCount = nTop;
+  Counters::add(Counters::LLK_DISTRIB_EVALUATIONS, distribCount);
 
   for (c=0; c<distribCount; c++)
   {
     v[c].idx = c;
-    lk += (v[c].lk = w[c] * d[c]->computeLK(f));
+    lk += (v[c].lk = w[c] * computeDistribLK(K::k, d[c], k, data, f));
   }
-  lkVect.descendingSort();
+  lkVect.descendingSort(nTop);
   //
   if (_config.getParam_computeLLKWithTopDistribs() == true) // COMPLETE
   {
@@ -264,23 +297,26 @@ lk_t S::computeLLK(const K&, const Mixture& m, const Feature& f,
 lk_t S::computeLLK(const K&, const Mixture& m, const Feature& f,
                    const LKVector& lkVect)
 {
+  Counters::Timer timer(Counters::LLK_TIME);
   lk_t lk = 0.0;
   weight_t* w = m.getTabWeight().getArray();
   Distrib** d = m.getTabDistrib();
   unsigned long distribCount = m.getDistribCount();
   unsigned long c, i, nTop = _config.getParam_topDistribsCount();
-
+  const DistribGD::LKKernel k = getLKKernel(m, f);
+  const real_t* data = f.getDataVector();
 
   if (nTop >= distribCount)
     nTop = distribCount;
   LKVector::type* v = lkVect.getArray();
   real_t sumTopDistribWeights = 0.0;
+  Counters::add(Counters::LLK_DISTRIB_EVALUATIONS, nTop);
 
   for (i=0; i<nTop; i++)
   {
     c = v[i].idx;
     sumTopDistribWeights += w[c];
-    lk += w[c] * d[c]->computeLK(f);
+    lk += w[c] * computeDistribLK(K::k, d[c], k, data, f);
   }
   if (_config.getParam_computeLLKWithTopDistribs()) {// COMPLETE
     lk += lkVect.sumNonTopDistribLK *
@@ -333,6 +369,23 @@ void S::setTopDistribIndexVector(const ULongVector& indexVect,
   _topDistribsVect.sumNonTopDistribLK = l;
 }
 //-------------------------------------------------------------------------
+void S::saveTopDistribs(TopDistribsCache& c) const
+{ c.addFrame(_topDistribsVect); }
+//-------------------------------------------------------------------------
+void S::loadTopDistribs(const TopDistribsCache& c, unsigned long frameIdx)
+{
+  unsigned long nTop = _config.getParam_topDistribsCount();
+  if (nTop > c.getDistribCount())
+    nTop = c.getDistribCount();
+  if (nTop != c.getTopDistribsCount())
+    throw Exception("The cache holds "
+          + String::valueOf(c.getTopDistribsCount())
+          + " top distributions per frame instead of "
+          + String::valueOf(nTop), __FILE__, __LINE__);
+  c.getFrame(frameIdx, _topDistribsVect);
+  Counters::add(Counters::TOP_DISTRIBS_CACHE_HITS, 1);
+}
+//-------------------------------------------------------------------------
 MixtureStat& S::getMixtureStat(const Mixture& m) // private
 {
   // TODO : not optimised...
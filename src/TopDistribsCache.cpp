@@ -0,0 +1,257 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_TopDistribsCache_cpp)
+#define ALIZE_TopDistribsCache_cpp
+
+#include <new>
+#include "TopDistribsCache.h"
+#include "LKVector.h"
+#include "FileReader.h"
+#include "FileWriter.h"
+#include "ByteSwap.h"
+#include "AutoDestructor.h"
+#include "Exception.h"
+#include "Config.h"
+
+using namespace alize;
+typedef TopDistribsCache C;
+
+static const char* MAGIC = "TOPDIST1";
+
+//-------------------------------------------------------------------------
+C::TopDistribsCache()
+:Object(), _distribCount(0), _topDistribsCount(0), _frameCount(0) {}
+//-------------------------------------------------------------------------
+C& C::create()
+{
+  TopDistribsCache* p = new (std::nothrow) TopDistribsCache();
+  assertMemoryIsAllocated(p, __FILE__, __LINE__);
+  return *p;
+}
+//-------------------------------------------------------------------------
+void C::addFrame(const LKVector& v)
+{
+  unsigned long i, nTop = v.topDistribsCount;
+  if (nTop > v.size())
+    nTop = v.size();
+  if (_frameCount == 0)
+  {
+    _distribCount = v.size();
+    _topDistribsCount = nTop;
+  }
+  else if (v.size() != _distribCount || nTop != _topDistribsCount)
+    throw Exception("Top distributions of the frame do not match the"
+          " cache", __FILE__, __LINE__);
+  const LKVector::type* a = v.getArray();
+  for (i=0; i<nTop; i++)
+    _indexVect.addValue(a[i].idx);
+  _sumNonTopDistribWeightsVect.addValue(v.sumNonTopDistribWeights);
+  _sumNonTopDistribLKVect.addValue(v.sumNonTopDistribLK);
+  _frameCount++;
+}
+//-------------------------------------------------------------------------
+void C::getFrame(unsigned long idx, LKVector& v) const
+{
+  assertIsInBounds(__FILE__, __LINE__, idx, _frameCount);
+  v.setSize(_distribCount);
+  LKVector::type* a = v.getArray();
+  const unsigned long* p = _indexVect.getArray()+idx*_topDistribsCount;
+  for (unsigned long i=0; i<_topDistribsCount; i++)
+  {
+    a[i].idx = p[i];
+    a[i].lk = 0.0;
+  }
+  v.topDistribsCount = _topDistribsCount;
+  v.sumNonTopDistribWeights = _sumNonTopDistribWeightsVect[idx];
+  v.sumNonTopDistribLK = _sumNonTopDistribLKVect[idx];
+}
+//-------------------------------------------------------------------------
+unsigned long C::getFrameCount() const { return _frameCount; }
+//-------------------------------------------------------------------------
+unsigned long C::getDistribCount() const { return _distribCount; }
+//-------------------------------------------------------------------------
+unsigned long C::getTopDistribsCount() const { return _topDistribsCount; }
+//-------------------------------------------------------------------------
+void C::clear()
+{
+  _distribCount = _topDistribsCount = _frameCount = 0;
+  _indexVect.clear();
+  _sumNonTopDistribWeightsVect.clear();
+  _sumNonTopDistribLKVect.clear();
+}
+//-------------------------------------------------------------------------
+FileName C::getFullFileName(const FileName& f, const Config& c) // private
+{
+  if (f.beginsWith("/") || f.beginsWith("./"))
+    return f;
+  String s(f);
+  if (c.existsParam_topDistribsCacheFilesPath)
+    s = c.getParam_topDistribsCacheFilesPath() + s;
+  if (c.existsParam_topDistribsCacheFileExtension)
+    s += c.getParam_topDistribsCacheFileExtension();
+  return s;
+}
+//-------------------------------------------------------------------------
+void C::load(const FileName& f, const Config& c)
+{
+  FileReader& r = FileReader::create(getFullFileName(f, c), "", "", false);
+  AutoDestructor ad(r);
+  const FileName& fullFileName = r.getFullFileName();
+  if (r.readString(8) != MAGIC)
+    throw InvalidDataException("Not a top distributions cache file",
+                               __FILE__, __LINE__, fullFileName);
+  r.readByteOrderCheck(); // can throw InvalidDataException
+  const bool swap = r.swap();
+  const unsigned long distribCount = r.readUInt4();
+  const unsigned long nTop = r.readUInt4();
+  const unsigned long frameCount = r.readUInt4();
+  const unsigned long indexSize = r.readUInt4();
+  if (nTop > distribCount || (indexSize != 2 && indexSize != 4))
+    throw InvalidDataException("Wrong top distributions cache header",
+                               __FILE__, __LINE__, fullFileName);
+  clear();
+  // indexes
+  const unsigned long indexCount = frameCount*nTop;
+  _indexVect.setSize(indexCount);
+  unsigned long* p = _indexVect.getArray();
+  unsigned long i, length = indexCount*indexSize;
+  if (length != 0)
+  {
+    unsigned char* b = new (std::nothrow) unsigned char[length];
+    assertMemoryIsAllocated(b, __FILE__, __LINE__);
+    if (r.readSomeBytes(b, length) != length)
+    {
+      delete [] b;
+      throw EOFException("", __FILE__, __LINE__, fullFileName);
+    }
+    if (swap)
+    {
+      if (indexSize == 2)
+        ByteSwap::swap2(b, indexCount);
+      else
+        ByteSwap::swap4(b, indexCount);
+    }
+    if (indexSize == 2)
+      for (i=0; i<indexCount; i++)
+        p[i] = ((unsigned short*)b)[i];
+    else
+      for (i=0; i<indexCount; i++)
+        p[i] = ((unsigned int*)b)[i];
+    delete [] b;
+  }
+  for (i=0; i<indexCount; i++)
+    if (p[i] >= distribCount)
+      throw InvalidDataException("Wrong distribution index",
+                                 __FILE__, __LINE__, fullFileName);
+  // sums
+  _sumNonTopDistribWeightsVect.setSize(frameCount);
+  _sumNonTopDistribLKVect.setSize(frameCount);
+  length = frameCount*sizeof(double);
+  if (r.readSomeBytes(_sumNonTopDistribWeightsVect.getArray(), length)
+      != length ||
+      r.readSomeBytes(_sumNonTopDistribLKVect.getArray(), length) != length)
+  {
+    clear();
+    throw EOFException("", __FILE__, __LINE__, fullFileName);
+  }
+  if (swap)
+  {
+    ByteSwap::swap8(_sumNonTopDistribWeightsVect.getArray(), frameCount);
+    ByteSwap::swap8(_sumNonTopDistribLKVect.getArray(), frameCount);
+  }
+  _distribCount = distribCount;
+  _topDistribsCount = nTop;
+  _frameCount = frameCount;
+}
+//-------------------------------------------------------------------------
+void C::save(const FileName& f, const Config& c) const
+{
+  FileWriter w(getFullFileName(f, c));
+  w.open(); // can throw IOException
+  const unsigned long indexCount = _indexVect.size();
+  const unsigned long* p = _indexVect.getArray();
+  const bool shortIndexes = (_distribCount <= 65536);
+  unsigned long i;
+  w.writeString(MAGIC);
+  w.writeByteOrderCheck();
+  w.writeUInt4(_distribCount);
+  w.writeUInt4(_topDistribsCount);
+  w.writeUInt4(_frameCount);
+  w.writeUInt4(shortIndexes ? 2 : 4);
+  if (shortIndexes)
+    for (i=0; i<indexCount; i++)
+      w.writeShort((short)(unsigned short)p[i]);
+  else
+    for (i=0; i<indexCount; i++)
+      w.writeUInt4(p[i]);
+  w.writeDoubles(_sumNonTopDistribWeightsVect.getArray(), _frameCount);
+  w.writeDoubles(_sumNonTopDistribLKVect.getArray(), _frameCount);
+  w.close();
+}
+//-------------------------------------------------------------------------
+String C::getClassName() const { return "TopDistribsCache"; }
+//-------------------------------------------------------------------------
+String C::toString() const
+{
+  return Object::toString()
+    + "\n  distribCount = " + String::valueOf(_distribCount)
+    + "\n  topDistribsCount = " + String::valueOf(_topDistribsCount)
+    + "\n  frameCount = " + String::valueOf(_frameCount);
+}
+//-------------------------------------------------------------------------
+C::~TopDistribsCache() {}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_TopDistribsCache_cpp)
@@ -70,12 +70,17 @@ using namespace std;
 
 //-------------------------------------------------------------------------
 ULongVector::ULongVector(unsigned long capacity, unsigned long size)
-:Object(), _size(0), _capacity(capacity!=0?capacity:1), 
+:Object(), _pAllocator(NULL), _size(0),
+_capacity(capacity!=0?capacity:1), _array(createArray()) { setSize(size); }
+//-------------------------------------------------------------------------
+ULongVector::ULongVector(unsigned long capacity, unsigned long size,
+                         Allocator& a)
+:Object(), _pAllocator(&a), _size(0), _capacity(capacity!=0?capacity:1),
 _array(createArray()) { setSize(size); }
 //-------------------------------------------------------------------------
 ULongVector::ULongVector(const ULongVector& v)
-:Object(), _size(v._size), _capacity(v._size!=0?v._size:1),
- _array(createArray())
+:Object(), _pAllocator(NULL), _size(v._size),
+ _capacity(v._size!=0?v._size:1), _array(createArray())
 { memcpy(_array, v._array, _size*sizeof(_array[0])); }
 //-------------------------------------------------------------------------
 const ULongVector& ULongVector::operator=(const ULongVector& v)
@@ -86,7 +91,7 @@ const ULongVector& ULongVector::operator=(const ULongVector& v)
   _size = v._size;
   if (_capacity < _size)
   {
-    delete[] _array;
+    deallocateArray(_array);
     _capacity = _size!=0?_size:1;
     _array = createArray();
   }
@@ -112,11 +117,21 @@ bool ULongVector::operator!=(const ULongVector& v) const
 ULongVector::_type* ULongVector::createArray() const // private
 {
   assert(_capacity != 0);
-  _type* p = new (std::nothrow) _type[_capacity];
+  const unsigned long s = _capacity*sizeof(_type);
+  _type* p = static_cast<_type*>(_pAllocator != NULL ?
+             _pAllocator->allocate(s) : Allocator::allocateAligned(s));
   assertMemoryIsAllocated(p, __FILE__, __LINE__);
   return p;
 }
 //-------------------------------------------------------------------------
+void ULongVector::deallocateArray(_type* p) const // private
+{
+  if (_pAllocator != NULL)
+    _pAllocator->deallocate(p);
+  else
+    Allocator::deallocateAligned(p);
+}
+//-------------------------------------------------------------------------
 ULongVector::_type& ULongVector::operator[](unsigned long i)
 {
   assertIsInBounds(__FILE__, __LINE__, i, _size);
@@ -140,7 +155,7 @@ ULongVector& ULongVector::addValue(_type element)
     _type* oldArray = _array;
     _array = createArray(); // can throw OutOfMemoryException
     memcpy(_array, oldArray, _size*sizeof(_array[0]));
-    delete[] oldArray;
+    deallocateArray(oldArray);
   }
   _array[_size] = element;
   _size++;
@@ -165,7 +180,7 @@ void ULongVector::setSize(unsigned long size)
     _type* oldArray = _array;
     _array = createArray(); // can throw OutOfMemoryException
     memcpy(_array, oldArray, oldSize*sizeof(_array[0]));
-    delete[] oldArray;
+    deallocateArray(oldArray);
   }
   else
     _size = size;
@@ -218,7 +233,7 @@ String ULongVector::toString() const
   return s;
 }
 //-------------------------------------------------------------------------
-ULongVector::~ULongVector() { delete[] _array; }
+ULongVector::~ULongVector() { deallocateArray(_array); }
 //-------------------------------------------------------------------------
 void ULongVector::setAllValues(unsigned long u) {
 	for (unsigned long i=0; i< _size; i++)
@@ -243,11 +258,9 @@ void ULongVector::load(const FileName& f) {
             if(!inputVect)
                 throw IOException("Cannot open file", __FILE__, __LINE__,f);
             inputVect.read((char*)&_size,sizeof(_size));
-			if (_capacity != 0) delete[] _array;
-			_array = new unsigned long[_size];
-			if (!_array)
-				throw Exception("Memory allocation exception", __FILE__, __LINE__);
-			_capacity=_size;
+			deallocateArray(_array);
+			_capacity = _size!=0?_size:1;
+			_array = createArray();
             inputVect.read((char*)_array,_size*sizeof(unsigned long));
             inputVect.close();
           }
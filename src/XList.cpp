@@ -94,6 +94,7 @@ const XList& XList::operator=(const XList& l)
   if (this != &l)
   {
     _vector.deleteAllObjects();
+    _index.clear();
     for (unsigned long i=0; i<l._vector.size(); i++)
       _vector.addObject(l._vector.getObject(i).duplicate());
     _current = 0;
@@ -179,16 +180,39 @@ XLine* XList::getLine() const
 //-------------------------------------------------------------------------
 XLine* XList::findLine(const String& key, unsigned long idx) const
 {
-  for (unsigned long i=0; i<_vector.size(); i++)
+  long i = findLineIndex(key, idx);
+  if (i == -1)
+    return NULL;
+  _current = i;
+  return &_vector.getObject(i);
+}
+//-------------------------------------------------------------------------
+long XList::findLineIndex(const String& key, unsigned long idx,
+                          bool rebuilt) const
+{
+  KeyIndex& index = _index[idx];
+  // index the lines added since the last search
+  for (; index.lineCount<_vector.size(); index.lineCount++)
   {
-    XLine& line = _vector.getObject(i);
-    if (idx < line.getElementCount() && line.getElement(idx) == key)
-    {
-      _current = i;
-      return &line;
-    }
+    XLine& line = _vector.getObject(index.lineCount);
+    if (idx < line.getElementCount())
+      index.map.insert(std::make_pair(line.getElement(idx, false),
+                                      index.lineCount)); // keeps the first
+  }
+  std::map<String, unsigned long>::const_iterator it = index.map.find(key);
+  if (it != index.map.end())
+  {
+    XLine& line = _vector.getObject(it->second);
+    if (idx < line.getElementCount() && line.getElement(idx, false) == key)
+      return it->second;
   }
-  return NULL;
+  if (rebuilt)
+    return -1;
+  // the key may be in a line completed (addElement()) or modified in
+  // place since it was indexed : the index is rebuilt once
+  index.map.clear();
+  index.lineCount = 0;
+  return findLineIndex(key, idx, true);
 }
 //-------------------------------------------------------------------------
 XLine& XList::getAllElements() const
@@ -238,6 +262,7 @@ void XList::sortByElementNumber(String order){
 
 	// Remove all elements from the XList
 	_vector.deleteAllObjects();
+	_index.clear();
 
 	// Fill the XList according to the number of elements
 	if(order == "descend"){
@@ -255,6 +280,7 @@ void XList::sortByElementNumber(String order){
 void XList::reset()
 {
   _vector.deleteAllObjects();
+  _index.clear();
   _current = 0;
 }
 //-------------------------------------------------------------------------
@@ -266,16 +292,10 @@ String XList::getClassName() const { return "XList"; }
  */
 String XList::searchValue(String& index)
 {
-  String result = "";
-  for (unsigned long i=0; i<_vector.size(); i++)
-  {
-    XLine& l = _vector.getObject(i);
-    if (l.getElement(0) == index) {
-      return l.getElement(1);
-      break;
-    }
-  }
-  return result;
+  long i = findLineIndex(index, 0);
+  if (i == -1)
+    return "";
+  return _vector.getObject(i).getElement(1);
 }
 //-------------------------------------------------------------------------
 String XList::toString() const
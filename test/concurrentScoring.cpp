@@ -0,0 +1,217 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+// Checks the concurrent scoring contract of MixtureServer : several
+// threads, each with its own StatServer, compute likelihoods with the
+// same MixtureServer (GD and GF mixtures, computeLLK(...), top
+// distributions determined then used, reading of the distributions).
+// Every thread must get exactly the result of a single thread run.
+// Run by "make check" (see Makefile.am for a ThreadSanitizer build).
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <pthread.h>
+#include "alize.h"
+
+using namespace alize;
+
+namespace
+{
+  const unsigned long VECT_SIZE = 13;
+  const unsigned long DISTRIB_COUNT = 32;
+  const unsigned long MIXTURE_COUNT = 6;
+  const unsigned long FRAME_COUNT = 300;
+  const unsigned long THREAD_COUNT = 8;
+  const unsigned long RUN_COUNT = 3; // StatServer objects by thread
+
+  struct Job
+  {
+    const Config*               pConfig;
+    MixtureServer*              pServer;
+    const std::vector<Feature>* pFeatures;
+    double                      results[RUN_COUNT];
+  };
+
+  double random(double min, double max)
+  { return min + (max-min)*rand()/(double)RAND_MAX; }
+
+  // mixture 0 determines the top distributions used by the others
+  double score(StatServer& ss, MixtureServer& ms,
+               const std::vector<Feature>& features)
+  {
+    double s = 0.0;
+    for (unsigned long t=0; t<features.size(); t++)
+    {
+      const Feature& f = features[t];
+      ss.computeAndAccumulateLLK(ms.getMixture(0), f, 1.0,
+                                 DETERMINE_TOP_DISTRIBS);
+      for (unsigned long k=1; k<MIXTURE_COUNT; k++)
+        s += k*ss.computeAndAccumulateLLK(ms.getMixture(k), f, 1.0,
+                                          USE_TOP_DISTRIBS);
+      for (unsigned long k=0; k<MIXTURE_COUNT; k++)
+        s += ss.computeLLK(ms.getMixture(k), f);
+      s += ms.getMixtureGD(1).getDistrib(3).getCov(2);
+    }
+    return s;
+  }
+
+  void* run(void* p)
+  {
+    Job& j = *static_cast<Job*>(p);
+    for (unsigned long r=0; r<RUN_COUNT; r++)
+    {
+      StatServer ss(*j.pConfig, *j.pServer);
+      j.results[r] = score(ss, *j.pServer, *j.pFeatures);
+    }
+    return NULL;
+  }
+
+  void createMixtures(MixtureServer& ms)
+  {
+    for (unsigned long k=0; k<MIXTURE_COUNT; k++)
+    {
+      if (k%2 == 0 || k == 1)
+      {
+        MixtureGD& m = ms.createMixtureGD(DISTRIB_COUNT);
+        for (unsigned long c=0; c<DISTRIB_COUNT; c++)
+        {
+          DistribGD& d = m.getDistrib(c);
+          for (unsigned long i=0; i<VECT_SIZE; i++)
+          {
+            d.setMean(random(-2.0, 2.0), i);
+            d.setCov(random(0.5, 1.5), i);
+          }
+          d.computeAll();
+          m.weight(c) = 1.0/DISTRIB_COUNT;
+        }
+      }
+      else
+      {
+        MixtureGF& m = ms.createMixtureGF(DISTRIB_COUNT);
+        for (unsigned long c=0; c<DISTRIB_COUNT; c++)
+        {
+          DistribGF& d = m.getDistrib(c);
+          for (unsigned long i=0; i<VECT_SIZE; i++)
+          {
+            d.setMean(random(-2.0, 2.0), i);
+            for (unsigned long l=0; l<VECT_SIZE; l++)
+              d.setCov(i == l ? random(1.0, 2.0) : 0.05, i, l);
+          }
+          d.computeAll();
+          m.weight(c) = 1.0/DISTRIB_COUNT;
+        }
+      }
+    }
+  }
+}
+
+int main()
+{
+  try
+  {
+    Config c;
+    c.setParam("vectSize", String::valueOf(VECT_SIZE));
+    c.setParam("mixtureDistribCount", String::valueOf(DISTRIB_COUNT));
+    c.setParam("maxLLK", "200");
+    c.setParam("minLLK", "-200");
+    c.setParam("topDistribsCount", "5");
+    c.setParam("computeLLKWithTopDistribs", "COMPLETE");
+    srand(2);
+    MixtureServer ms(c);
+    createMixtures(ms);
+    std::vector<Feature> features;
+    Feature f(VECT_SIZE);
+    for (unsigned long t=0; t<FRAME_COUNT; t++)
+    {
+      for (unsigned long i=0; i<VECT_SIZE; i++)
+        f[i] = random(-2.0, 2.0);
+      features.push_back(f);
+    }
+
+    StatServer ss(c, ms);
+    const double reference = score(ss, ms, features);
+
+    std::vector<Job> jobs(THREAD_COUNT);
+    std::vector<pthread_t> threads(THREAD_COUNT);
+    unsigned long t;
+    for (t=0; t<THREAD_COUNT; t++)
+    {
+      jobs[t].pConfig = &c;
+      jobs[t].pServer = &ms;
+      jobs[t].pFeatures = &features;
+      if (pthread_create(&threads[t], NULL, run, &jobs[t]) != 0)
+      {
+        fprintf(stderr, "cannot create thread %lu\n", t);
+        return EXIT_FAILURE;
+      }
+    }
+    unsigned long errorCount = 0;
+    for (t=0; t<THREAD_COUNT; t++)
+    {
+      pthread_join(threads[t], NULL);
+      for (unsigned long r=0; r<RUN_COUNT; r++)
+        if (jobs[t].results[r] != reference)
+          errorCount++;
+    }
+    printf("reference %.17g : %lu/%lu thread results differ\n", reference,
+           errorCount, THREAD_COUNT*RUN_COUNT);
+    return errorCount == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+  catch (Exception& e)
+  {
+    fprintf(stderr, "%s\n", e.toString().c_str());
+    return EXIT_FAILURE;
+  }
+}
@@ -0,0 +1,137 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+// Benchmark of the likelihood kernels of DistribGD (getLKKernel()) for
+// the specialized dimensions : a plain loop with one sum (the computation
+// before the kernels), the generic kernel and the kernel of the
+// dimension. Prints the cost of one likelihood in nanoseconds (best of
+// several runs, 512 distributions) and the relative difference of the
+// sums of the likelihoods with the plain loop.
+// Built by "make check", run by hand : ./lkKernelBench
+
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <ctime>
+#include <vector>
+#include "alize.h"
+
+using namespace alize;
+
+namespace
+{
+  typedef DistribGD::LKKernel LKKernel;
+
+  const unsigned long DISTRIB_COUNT = 512;
+  const unsigned long FRAME_COUNT = 1000;
+  const unsigned long RUN_COUNT = 5;
+
+  lk_t plainLoop(const real_t* f, const real_t* m, const real_t* c,
+                 real_t cst, unsigned long n)
+  {
+    real_t d = 0.0;
+    for (unsigned long i=0; i<n; i++)
+      d += (f[i]-m[i])*(f[i]-m[i])*c[i];
+    const lk_t lk = cst*exp(-0.5*d);
+    return lk != lk ? 1e-200 : lk;
+  }
+
+  double random(double min, double max)
+  { return min + (max-min)*rand()/(double)RAND_MAX; }
+}
+
+int main()
+{
+  const unsigned long vectSizes[] = {20, 39, 40, 50, 60};
+  const char* const names[] = {"plain loop", "generic", "specialized"};
+  srand(7);
+  printf("ns per likelihood, %lu distributions\n", DISTRIB_COUNT);
+  printf("dim  %10s %10s %12s  rel. diff\n", names[0], names[1], names[2]);
+  for (unsigned long a=0; a<5; a++)
+  {
+    const unsigned long n = vectSizes[a];
+    std::vector<real_t> mean(DISTRIB_COUNT*n), covInv(DISTRIB_COUNT*n);
+    std::vector<real_t> data(FRAME_COUNT*n);
+    unsigned long i;
+    for (i=0; i<mean.size(); i++)
+    {
+      mean[i] = random(-0.3, 0.3);
+      covInv[i] = 1.0/random(0.8, 1.8);
+    }
+    for (i=0; i<data.size(); i++)
+      data[i] = random(-1.0, 1.0);
+    // no dimension 0 kernel : getLKKernel(0) is the generic one
+    const LKKernel kernels[3] = {plainLoop, DistribGD::getLKKernel(0UL),
+                                 DistribGD::getLKKernel(n)};
+    double best[3], sums[3];
+    for (unsigned long run=0; run<RUN_COUNT; run++)
+      for (unsigned long k=0; k<3; k++)
+      {
+        const LKKernel kernel = kernels[k];
+        double s = 0.0;
+        const clock_t t0 = clock();
+        for (unsigned long t=0; t<FRAME_COUNT; t++)
+          for (unsigned long c=0; c<DISTRIB_COUNT; c++)
+            s += kernel(&data[t*n], &mean[c*n], &covInv[c*n], 1e-10, n);
+        const double ns = (clock()-t0)/(double)CLOCKS_PER_SEC*1e9
+                          /(FRAME_COUNT*DISTRIB_COUNT);
+        if (run == 0 || ns < best[k])
+          best[k] = ns;
+        sums[k] = s;
+      }
+    printf("%3lu  %10.1f %10.1f %12.1f  %.2g\n", n, best[0], best[1],
+           best[2], fabs(sums[2]-sums[0])/fabs(sums[0]));
+  }
+  return EXIT_SUCCESS;
+}
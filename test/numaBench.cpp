@@ -0,0 +1,235 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+// Per NUMA node bandwidth of the likelihood computation. One thread by
+// node (Numa::getNodeCount()) binds itself to its node
+// (Numa::bindThreadToNode()), replicates the models in its own
+// MixtureServer (MixtureServer::replicate()) and scores its part of the
+// models (Numa::getPartition()) twice : with the models of the shared
+// server, allocated by the main thread, then with its local replica.
+// Prints the model data read by second for each node.
+// Built by "make check", run by hand :
+//   ./numaBench [mixtureCount [frameCount]]
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <pthread.h>
+#include <sys/time.h>
+#include "alize.h"
+
+using namespace alize;
+
+namespace
+{
+  const unsigned long VECT_SIZE = 39;
+  const unsigned long DISTRIB_COUNT = 512;
+
+  struct Job
+  {
+    const Config*               pConfig;
+    MixtureServer*              pShared;
+    const std::vector<Feature>* pFeatures;
+    unsigned long               node;
+    unsigned long               nodeCount;
+    bool                        bound;
+    unsigned long               mixtureCount;
+    double                      sharedBandwidth; // GB/s
+    double                      localBandwidth;  // GB/s
+    bool                        sameLLK;
+  };
+
+  double getTime()
+  {
+    timeval t;
+    gettimeofday(&t, NULL);
+    return t.tv_sec + t.tv_usec*1e-6;
+  }
+
+  double random(double min, double max)
+  { return min + (max-min)*rand()/(double)RAND_MAX; }
+
+  // scores each frame with the mixtures [first, first+count[ (the models
+  // do not stay in the caches) and returns the bandwidth
+  double score(StatServer& ss, const MixtureServer& ms, unsigned long first,
+               unsigned long count, const std::vector<Feature>& features,
+               double& llk)
+  {
+    double bytes = 0.0;
+    llk = 0.0;
+    const double t0 = getTime();
+    for (unsigned long t=0; t<features.size(); t++)
+      for (unsigned long i=first; i<first+count; i++)
+      {
+        const Mixture& m = ms.getMixture(i);
+        llk += ss.computeLLK(m, features[t]);
+        // mean, inverse covariance, constant and weight of the distributions
+        bytes += m.getDistribCount()*(2*m.getVectSize()+2)*sizeof(real_t);
+      }
+    const double t = getTime()-t0;
+    return t > 0.0 ? bytes/t/1e9 : 0.0;
+  }
+
+  void* run(void* p)
+  {
+    Job& j = *static_cast<Job*>(p);
+    j.sameLLK = false;
+    try
+    {
+      j.bound = Numa::bindThreadToNode(j.node);
+      unsigned long first, count;
+      Numa::getPartition(j.pShared->getMixtureCount(), j.nodeCount,
+                         j.node, first, count);
+      j.mixtureCount = count;
+      double sharedLLK, localLLK;
+      {
+        StatServer ss(*j.pConfig, *j.pShared);
+        j.sharedBandwidth = score(ss, *j.pShared, first, count,
+                                  *j.pFeatures, sharedLLK);
+      }
+      MixtureServer local(*j.pConfig); // in the memory of the node
+      local.replicate(*j.pShared);
+      StatServer ss(*j.pConfig, local);
+      j.localBandwidth = score(ss, local, first, count, *j.pFeatures,
+                               localLLK);
+      j.sameLLK = localLLK == sharedLLK;
+    }
+    catch (Exception& e)
+    {
+      fprintf(stderr, "node %lu : %s\n", j.node, e.toString().c_str());
+    }
+    return NULL;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  try
+  {
+    const unsigned long mixtureCount = argc > 1 ? atol(argv[1]) : 64;
+    const unsigned long frameCount = argc > 2 ? atol(argv[2]) : 100;
+    Config c;
+    c.setParam("vectSize", String::valueOf(VECT_SIZE));
+    c.setParam("mixtureDistribCount", String::valueOf(DISTRIB_COUNT));
+    c.setParam("maxLLK", "200");
+    c.setParam("minLLK", "-200");
+    srand(1);
+    MixtureServer shared(c);
+    unsigned long i, k;
+    for (k=0; k<mixtureCount; k++)
+    {
+      MixtureGD& m = shared.createMixtureGD(DISTRIB_COUNT);
+      for (i=0; i<DISTRIB_COUNT; i++)
+      {
+        DistribGD& d = m.getDistrib(i);
+        for (unsigned long j=0; j<VECT_SIZE; j++)
+        {
+          d.setMean(random(-2.0, 2.0), j);
+          d.setCov(random(0.5, 1.5), j);
+        }
+        d.computeAll();
+        m.weight(i) = 1.0/DISTRIB_COUNT;
+      }
+    }
+    std::vector<Feature> features;
+    Feature f(VECT_SIZE);
+    for (unsigned long t=0; t<frameCount; t++)
+    {
+      for (i=0; i<VECT_SIZE; i++)
+        f[i] = random(-2.0, 2.0);
+      features.push_back(f);
+    }
+
+    const unsigned long nodeCount = Numa::getNodeCount();
+    printf("%lu nodes, %lu mixtures %lux%lu, %lu frames\n", nodeCount,
+           mixtureCount, DISTRIB_COUNT, VECT_SIZE, frameCount);
+    std::vector<Job> jobs(nodeCount);
+    std::vector<pthread_t> threads(nodeCount);
+    for (k=0; k<nodeCount; k++)
+    {
+      Job& j = jobs[k];
+      j.bound = false;
+      j.mixtureCount = 0;
+      j.sharedBandwidth = j.localBandwidth = 0.0;
+      j.pConfig = &c;
+      j.pShared = &shared;
+      j.pFeatures = &features;
+      j.node = k;
+      j.nodeCount = nodeCount;
+      if (pthread_create(&threads[k], NULL, run, &j) != 0)
+      {
+        fprintf(stderr, "cannot create thread %lu\n", k);
+        return EXIT_FAILURE;
+      }
+    }
+    int status = EXIT_SUCCESS;
+    printf("node  bound  mixtures  shared (GB/s)  local (GB/s)\n");
+    for (k=0; k<nodeCount; k++)
+    {
+      pthread_join(threads[k], NULL);
+      const Job& j = jobs[k];
+      printf("%4lu  %5s  %8lu  %13.2f  %12.2f%s\n", k,
+             j.bound ? "yes" : "no", j.mixtureCount, j.sharedBandwidth,
+             j.localBandwidth, j.sameLLK ? "" : "  DIFFERENT LLK");
+      if (!j.sameLLK)
+        status = EXIT_FAILURE;
+    }
+    return status;
+  }
+  catch (Exception& e)
+  {
+    fprintf(stderr, "%s\n", e.toString().c_str());
+    return EXIT_FAILURE;
+  }
+}
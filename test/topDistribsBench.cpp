@@ -0,0 +1,155 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+// Benchmark of the top distributions selection of
+// StatServer::computeLLK(..., DETERMINE_TOP_DISTRIBS) : full sort of the
+// LKVector (descendingSort()) against the selection of the k best
+// distributions (descendingSort(k)), for k = 5, 10, 20 and 512 to 4096
+// distributions. Prints the cost per frame in microseconds (best of
+// several runs) and checks that both select the same distributions.
+// Built by "make check", run by hand : ./topDistribsBench
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <vector>
+#include "alize.h"
+
+using namespace alize;
+
+namespace
+{
+  const unsigned long SOURCE_COUNT = 16; // different LK vectors
+  const unsigned long RUN_COUNT = 3;
+
+  // fills v with the likelihoods of the source r%SOURCE_COUNT
+  void fill(LKVector& v, const std::vector<double>& lk, unsigned long r)
+  {
+    const unsigned long n = v.size();
+    LKVector::type* p = v.getArray();
+    const double* s = &lk[(r%SOURCE_COUNT)*n];
+    for (unsigned long i=0; i<n; i++)
+    {
+      p[i].idx = i;
+      p[i].lk = s[i];
+    }
+  }
+
+  // cost per frame in microseconds of the full sort (k == 0) or of the
+  // selection of the k best
+  double measure(LKVector& v, const std::vector<double>& lk,
+                 unsigned long k, unsigned long frameCount)
+  {
+    double best = 0.0;
+    for (unsigned long run=0; run<RUN_COUNT; run++)
+    {
+      const clock_t t0 = clock();
+      for (unsigned long r=0; r<frameCount; r++)
+      {
+        fill(v, lk, r);
+        if (k == 0)
+          v.descendingSort();
+        else
+          v.descendingSort(k);
+      }
+      const double t = (clock()-t0)/(double)CLOCKS_PER_SEC*1e6/frameCount;
+      if (run == 0 || t < best)
+        best = t;
+    }
+    return best;
+  }
+
+  bool sameSelection(LKVector& v, LKVector& w, const std::vector<double>& lk,
+                     unsigned long k)
+  {
+    for (unsigned long r=0; r<SOURCE_COUNT; r++)
+    {
+      fill(v, lk, r);
+      v.descendingSort();
+      fill(w, lk, r);
+      w.descendingSort(k);
+      for (unsigned long i=0; i<k; i++)
+        if (v[i].idx != w[i].idx)
+          return false;
+    }
+    return true;
+  }
+}
+
+int main()
+{
+  const unsigned long distribCounts[] = {512, 1024, 2048, 4096};
+  const unsigned long topCounts[] = {5, 10, 20};
+  srand(3);
+  printf("    n   k  full sort (us)  selection (us)\n");
+  for (unsigned long a=0; a<4; a++)
+  {
+    const unsigned long n = distribCounts[a];
+    const unsigned long frameCount = 5000*512/n;
+    // likelihoods of very different magnitudes, as in a real mixture
+    std::vector<double> lk(n*SOURCE_COUNT);
+    for (unsigned long i=0; i<lk.size(); i++)
+      lk[i] = rand()/(double)RAND_MAX*1e-3*(rand()%3 == 0 ? 1e-5 : 1.0);
+    LKVector v(n, n), w(n, n);
+    for (unsigned long b=0; b<3; b++)
+    {
+      const unsigned long k = topCounts[b];
+      const double full = measure(v, lk, 0, frameCount);
+      const double selection = measure(v, lk, k, frameCount);
+      printf("%5lu %3lu %15.2f %15.2f%s\n", n, k, full, selection,
+             sameSelection(v, w, lk, k) ? "" : "  DIFFERENT SELECTION");
+    }
+  }
+  return EXIT_SUCCESS;
+}